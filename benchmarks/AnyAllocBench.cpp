@@ -0,0 +1,143 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+// Counts global heap allocations so each API can report allocations per call for the
+// configured NGIN_REFLECTION_ANY_SBO_BYTES. Rebuild with a different value to compare.
+namespace
+{
+  std::atomic<std::size_t> g_allocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace AnyAllocBenchDemo
+{
+  struct Mat4
+  {
+    float m[16]{};
+  };
+
+  struct Aabb
+  {
+    double min[3]{};
+    double max[3]{};
+  };
+
+  struct Body
+  {
+    Mat4 transform{};
+    Aabb bounds{};
+    std::string name{"a body name that does not fit a short string buffer"};
+
+    Aabb GetBounds() const { return bounds; }
+    void SetBounds(Aabb b) { bounds = b; }
+    Mat4 World() const { return transform; }
+
+    friend void NginReflect(Reflection::Tag<Body>, Reflection::TypeBuilder<Body> &b)
+    {
+      b.Field<&Body::transform>("transform");
+      b.Field<&Body::name>("name");
+      b.Property<&Body::GetBounds, &Body::SetBounds>("bounds");
+      b.Method<&Body::World>("World");
+    }
+  };
+} // namespace AnyAllocBenchDemo
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using AnyAllocBenchDemo::Body;
+
+  auto t = GetType<Body>();
+  auto transform = t.GetField("transform").value();
+  auto name = t.GetField("name").value();
+  auto bounds = t.GetProperty("bounds").value();
+  auto world = t.GetMethod("World").value();
+  Body body{};
+  constexpr int kIterations = 10000;
+
+  auto report = [&](const char *label, auto &&op)
+  {
+    const auto before = g_allocations.load(std::memory_order_relaxed);
+    for (int i = 0; i < kIterations; ++i)
+      op();
+    const auto count = g_allocations.load(std::memory_order_relaxed) - before;
+    std::cout << label << ": " << static_cast<double>(count) / kIterations << " allocations/call\n";
+  };
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    ctx.start();
+    for (int i=0;i<kIterations;++i)
+    {
+      auto v = transform.GetAny(body);
+      ctx.doNotOptimize(v);
+    }
+    ctx.stop(); }, "Field GetAny Mat4 (64B) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    ctx.start();
+    for (int i=0;i<kIterations;++i)
+    {
+      auto v = bounds.GetAny(body);
+      ctx.doNotOptimize(v);
+    }
+    ctx.stop(); }, "Property GetAny Aabb (48B) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    const Any *noArgs = nullptr;
+    ctx.start();
+    for (int i=0;i<kIterations;++i)
+    {
+      auto v = world.Invoke(&body, noArgs, 0);
+      ctx.doNotOptimize(v);
+    }
+    ctx.stop(); }, "Method Invoke -> Mat4 (64B) 10k");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+
+  std::cout << "Any small buffer: " << kAnySmallBufferBytes << " bytes\n";
+  const Any *noArgs = nullptr;
+  report("Field GetAny Mat4 (64B)", [&]
+         { auto v = transform.GetAny(body); });
+  report("Field GetAny std::string", [&]
+         { auto v = name.GetAny(body); });
+  report("Property GetAny Aabb (48B)", [&]
+         { auto v = bounds.GetAny(body); });
+  report("Method Invoke -> Mat4 (64B)", [&]
+         { auto v = world.Invoke(&body, noArgs, 0); });
+
+  {
+    AnyArenaScope scope{};
+    report("Field GetAny Mat4 (64B) in AnyArenaScope", [&]
+           { auto v = transform.GetAny(body); });
+    report("Property GetAny Aabb (48B) in AnyArenaScope", [&]
+           { auto v = bounds.GetAny(body); });
+    report("Method Invoke -> Mat4 (64B) in AnyArenaScope", [&]
+           { auto v = world.Invoke(&body, noArgs, 0); });
+  }
+  const auto arena = GetAnyArenaStats();
+  std::cout << "Any spills: " << arena.arenaAllocations << " from arenas, " << arena.heapAllocations
+            << " from the system allocator\n";
+  return 0;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+namespace CallSiteBenchDemo
+{
+  struct Obj
+  {
+    int n{0};
+    int add(int v) const { return n + v; }
+    int add(double v) const { return n + static_cast<int>(v); }
+    friend void NginReflect(Reflection::Tag<Obj>, Reflection::TypeBuilder<Obj> &b)
+    {
+      b.Method<static_cast<int (Obj::*)(int) const>(&Obj::add)>("add");
+      b.Method<static_cast<int (Obj::*)(double) const>(&Obj::add)>("add");
+    }
+  };
+}
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using CallSiteBenchDemo::Obj;
+
+  auto t = GetType<Obj>();
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    volatile int v = 7;
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i)
+      sum += o.add(static_cast<int>(v));
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "Direct call add(int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    Any arg{7};
+    auto resolved = t.ResolveMethod("add", &arg, 1).value();
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i)
+      sum += resolved.Invoke(&o, &arg, 1).value().Cast<int>();
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "Pre-resolved Invoke add(int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    Any arg{7};
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i)
+      sum += t.ResolveMethod("add", &arg, 1).value().Invoke(&o, &arg, 1).value().Cast<int>();
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "ResolveMethod+Invoke add(int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    Any arg{7};
+    CallSite site{"add"};
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i)
+      sum += site.Invoke(t, &o, &arg, 1).value().Cast<int>();
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "CallSite Invoke add(int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    Any args[2] = {Any{7}, Any{2.0}};
+    CallSite site{"add"};
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i)
+      sum += site.Invoke(t, &o, &args[i & 1], 1).value().Cast<int>();
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "CallSite Invoke add(int|double) 10k");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+namespace JsonBenchDemo
+{
+  enum class Team
+  {
+    Red,
+    Blue,
+  };
+  inline void NginReflect(Reflection::Tag<Team>, Reflection::TypeBuilder<Team> &b)
+  {
+    b.EnumValue("Red", Team::Red);
+    b.EnumValue("Blue", Team::Blue);
+  }
+
+  struct Player
+  {
+    std::string name{"player"};
+    int level{12};
+    float health{87.5f};
+    double x{1024.25}, y{-77.125}, z{3.5};
+    Team team{Team::Blue};
+    std::vector<int> inventory{1, 2, 3, 5, 8, 13};
+    friend void NginReflect(Reflection::Tag<Player>, Reflection::TypeBuilder<Player> &b)
+    {
+      b.Field<&Player::name>("name");
+      b.Field<&Player::level>("level");
+      b.Field<&Player::health>("health");
+      b.Field<&Player::x>("x");
+      b.Field<&Player::y>("y");
+      b.Field<&Player::z>("z");
+      b.Field<&Player::team>("team");
+      b.Field<&Player::inventory>("inventory");
+    }
+  };
+}
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using JsonBenchDemo::Player;
+
+  constexpr int kPlayers = 1000;
+  std::vector<Player> players(kPlayers);
+  JsonSerializer json;
+
+  // One document per player, concatenated; the reader walks them back to back.
+  std::string text;
+  for (const auto &p : players)
+    (void)json.Write(p, text);
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    std::string out;
+    out.reserve(text.size());
+    ctx.start();
+    for (const auto &p : players)
+      (void)json.Write(p, out);
+    ctx.doNotOptimize(out.size());
+    ctx.stop(); }, "JsonSerializer Write 1k objects");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Player p{};
+    ctx.start();
+    JsonReader in{text};
+    for (int i = 0; i < kPlayers; ++i)
+      (void)json.Read(p, in);
+    ctx.doNotOptimize(p.level);
+    ctx.stop(); }, "JsonSerializer Read 1k objects");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+
+  // Throughput over repeated passes of the whole document set.
+  constexpr int kPasses = 200;
+  auto report = [&](const char *label, auto &&pass)
+  {
+    const auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < kPasses; ++i)
+      pass();
+    const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+    const double megabytes = static_cast<double>(text.size()) * kPasses / (1024.0 * 1024.0);
+    std::cout << label << ": " << megabytes / seconds.count() << " MB/s\n";
+  };
+
+  std::string out;
+  out.reserve(text.size());
+  report("JsonSerializer Write", [&]
+         {
+    out.clear();
+    for (const auto &p : players)
+      (void)json.Write(p, out); });
+  Player sink{};
+  report("JsonSerializer Read", [&]
+         {
+    JsonReader in{text};
+    for (int i = 0; i < kPlayers; ++i)
+      (void)json.Read(sink, in); });
+  std::cout << "Document bytes per pass: " << text.size() << "\n";
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+namespace MapperBenchDemo
+{
+  struct NetPlayerState
+  {
+    int id{0};
+    float x{0}, y{0}, z{0};
+    float yaw{0};
+    short health{100};
+    std::string name{"player"};
+    friend void NginReflect(Reflection::Tag<NetPlayerState>, Reflection::TypeBuilder<NetPlayerState> &b)
+    {
+      b.Field<&NetPlayerState::id>("id");
+      b.Field<&NetPlayerState::x>("x");
+      b.Field<&NetPlayerState::y>("y");
+      b.Field<&NetPlayerState::z>("z");
+      b.Field<&NetPlayerState::yaw>("yaw");
+      b.Field<&NetPlayerState::health>("health");
+      b.Field<&NetPlayerState::name>("name");
+    }
+  };
+
+  struct Player
+  {
+    int id{0};
+    float x{0}, y{0}, z{0};
+    float yaw{0};
+    int health{0};
+    std::string name{};
+    int score{0};
+    friend void NginReflect(Reflection::Tag<Player>, Reflection::TypeBuilder<Player> &b)
+    {
+      b.Field<&Player::id>("id");
+      b.Field<&Player::x>("x");
+      b.Field<&Player::y>("y");
+      b.Field<&Player::z>("z");
+      b.Field<&Player::yaw>("yaw");
+      b.Field<&Player::health>("health");
+      b.Field<&Player::name>("name");
+      b.Field<&Player::score>("score");
+    }
+  };
+}
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using MapperBenchDemo::NetPlayerState;
+  using MapperBenchDemo::Player;
+
+  auto src = GetType<NetPlayerState>();
+  auto dst = GetType<Player>();
+  std::vector<NetPlayerState> states(1000);
+  std::vector<Player> players(states.size());
+
+  // Name lookup per field and object, values moved through Any.
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    const auto fieldCount = dst.FieldCount();
+    ctx.start();
+    for (NGIN::UIntSize i = 0; i < states.size(); ++i)
+    {
+      for (NGIN::UIntSize f = 0; f < fieldCount; ++f)
+      {
+        auto to = dst.FieldAt(f);
+        auto from = src.GetField(to.Name());
+        if (!from.has_value())
+          continue;
+        (void)to.SetAny(&players[i], from->GetAny(&states[i]));
+      }
+    }
+    ctx.doNotOptimize(players.data());
+    ctx.stop(); }, "GetField + GetAny/SetAny 1k objects");
+
+  auto mapper = Mapper::Compile(src, dst);
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    ctx.start();
+    mapper->ApplyArray(states.data(), players.data(), states.size());
+    ctx.doNotOptimize(players.data());
+    ctx.stop(); }, "Mapper ApplyArray 1k objects");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+  return 0;
+}
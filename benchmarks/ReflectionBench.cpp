@@ -21,6 +21,7 @@ namespace BenchDemo
       b.Field<&Obj::n>("n");
       b.Field<&Obj::p>("p");
       b.Method<&Obj::add>("add");
+      b.Constructor<int>();
     }
   };
 }
@@ -90,6 +91,45 @@ int main()
     ctx.doNotOptimize(sum);
     ctx.stop(); }, "Method Invoke add(conv double->int) 10k");
 
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Obj o{5};
+    Any arg{static_cast<short>(7)};
+    auto resolved = t.ResolveMethod("add", &arg, 1).value();
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i) {
+      auto out = resolved.Invoke(&o, &arg, 1).value();
+      sum += out.Cast<int>();
+    }
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "ResolvedMethod Invoke add(conv short->int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Any arg{7};
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i) {
+      auto out = t.Construct(&arg, 1).value();
+      sum += out.Cast<Obj>().n;
+    }
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "Type Construct Obj(int) 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Any arg{7};
+    auto ctor = t.ResolveConstructor<int>().value();
+    ctx.start();
+    int sum = 0;
+    for (int i=0;i<10000;++i) {
+      auto out = ctor.Construct(&arg, 1).value();
+      sum += out.Cast<Obj>().n;
+    }
+    ctx.doNotOptimize(sum);
+    ctx.stop(); }, "ResolvedConstructor Construct Obj(int) 10k");
+
   auto results = Benchmark::RunAll<Milliseconds>();
   Benchmark::PrintSummaryTable(std::cout, results);
   return 0;
@@ -0,0 +1,74 @@
+#include <iostream>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+namespace ResolutionCacheBenchDemo
+{
+  struct Obj
+  {
+    int n{0};
+    int add(int v) const { return n + v; }
+    int add(int a, int b) const { return n + a + b; }
+    double add(double v) const { return n + v; }
+    float add(float v) const { return static_cast<float>(n) + v; }
+    friend void NginReflect(Reflection::Tag<Obj>, Reflection::TypeBuilder<Obj> &b)
+    {
+      b.Method<static_cast<int (Obj::*)(int) const>(&Obj::add)>("add");
+      b.Method<static_cast<int (Obj::*)(int, int) const>(&Obj::add)>("add");
+      b.Method<static_cast<double (Obj::*)(double) const>(&Obj::add)>("add");
+      b.Method<static_cast<float (Obj::*)(float) const>(&Obj::add)>("add");
+    }
+  };
+}
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using ResolutionCacheBenchDemo::Obj;
+
+  auto t = GetType<Obj>();
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Any arg{static_cast<short>(7)};
+    ctx.start();
+    int ok = 0;
+    for (int i=0;i<10000;++i) {
+      ClearResolutionCache();
+      ok += t.ResolveMethod("add", &arg, 1).has_value() ? 1 : 0;
+    }
+    ctx.doNotOptimize(ok);
+    ctx.stop(); }, "ResolveMethod add(short) cold 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Any arg{static_cast<short>(7)};
+    ClearResolutionCache();
+    ctx.start();
+    int ok = 0;
+    for (int i=0;i<10000;++i)
+      ok += t.ResolveMethod("add", &arg, 1).has_value() ? 1 : 0;
+    ctx.doNotOptimize(ok);
+    ctx.stop(); }, "ResolveMethod add(short) cached 10k");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    Any args[2] = {Any{1}, Any{2}};
+    ClearResolutionCache();
+    ctx.start();
+    int ok = 0;
+    for (int i=0;i<10000;++i)
+      ok += t.ResolveMethod("add", args, 2).has_value() ? 1 : 0;
+    ctx.doNotOptimize(ok);
+    ctx.stop(); }, "ResolveMethod add(int,int) cached 10k");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+  const auto stats = GetResolutionCacheStats();
+  std::cout << "resolution cache hit rate: " << stats.HitRate() * 100.0 << "% (" << stats.hits << " hits, "
+            << stats.misses << " misses)\n";
+  return 0;
+}
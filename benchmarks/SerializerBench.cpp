@@ -0,0 +1,84 @@
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <NGIN/Benchmark.hpp>
+#include <NGIN/Reflection/Reflection.hpp>
+
+using namespace NGIN;
+
+namespace SerializerBenchDemo
+{
+  struct Particle
+  {
+    float x{0}, y{0}, z{0};
+    float vx{0}, vy{0}, vz{0};
+    int id{0};
+    std::string tag{"spark"};
+    friend void NginReflect(Reflection::Tag<Particle>, Reflection::TypeBuilder<Particle> &b)
+    {
+      b.Field<&Particle::x>("x");
+      b.Field<&Particle::y>("y");
+      b.Field<&Particle::z>("z");
+      b.Field<&Particle::vx>("vx");
+      b.Field<&Particle::vy>("vy");
+      b.Field<&Particle::vz>("vz");
+      b.Field<&Particle::id>("id");
+      b.Field<&Particle::tag>("tag");
+    }
+  };
+}
+
+int main()
+{
+  using namespace NGIN::Reflection;
+  using SerializerBenchDemo::Particle;
+
+  auto t = GetType<Particle>();
+  std::vector<Particle> particles(1000);
+  std::vector<std::byte> buffer(particles.size() * 64);
+
+  // Per-field reflection: one Any per field, switching on the field type.
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    const auto fieldCount = t.FieldCount();
+    const auto stringId = detail::TypeIdOf<std::string>();
+    ctx.start();
+    NGIN::UIntSize off = 0;
+    for (const auto &p : particles)
+    {
+      for (NGIN::UIntSize i = 0; i < fieldCount; ++i)
+      {
+        auto v = t.FieldAt(i).GetAny(&p);
+        if (v.GetTypeId() == stringId)
+        {
+          const auto &s = v.Cast<std::string>();
+          std::memcpy(buffer.data() + off, s.data(), s.size());
+          off += s.size();
+        }
+        else
+        {
+          std::memcpy(buffer.data() + off, v.Data(), v.Size());
+          off += v.Size();
+        }
+      }
+    }
+    ctx.doNotOptimize(off);
+    ctx.stop(); }, "Field loop GetAny 1k objects");
+
+  Benchmark::Register([&](BenchmarkContext &ctx)
+                      {
+    BinarySerializer serializer;
+    ctx.start();
+    BinaryWriter out{buffer};
+    for (const auto &p : particles)
+      (void)serializer.Write(p, out);
+    ctx.doNotOptimize(out.Required());
+    ctx.stop(); }, "BinarySerializer Write 1k objects");
+
+  auto results = Benchmark::RunAll<Milliseconds>();
+  NGIN::Benchmark::PrintSummaryTable(std::cout, results);
+  return 0;
+}
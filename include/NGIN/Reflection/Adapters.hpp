@@ -21,9 +21,9 @@
 namespace NGIN::Reflection::Adapters
 {
 
-using Any = NGIN::Utilities::Any<>;
-using AnyView = Any::View;
-using ConstAnyView = Any::ConstView;
+using Any = NGIN::Reflection::Any;
+using AnyView = NGIN::Reflection::AnyView;
+using ConstAnyView = NGIN::Reflection::ConstAnyView;
 
   // Sequence detection (std::vector, NGIN::Containers::Vector)
   template <class T>
@@ -413,4 +413,15 @@ using ConstAnyView = Any::ConstView;
     return FlatHashMapAdapter<Map>{m};
   }
 
+  // Start an adapter from a view (Field::GetView, Property::GetView, ElementView) instead of
+  // a copied Any, e.g. AdaptView<SequenceAdapter, std::vector<int>>(view). Fails unless the
+  // view refers to exactly a C.
+  template <template <class> class Adapter, class C>
+  std::expected<Adapter<C>, Error> AdaptView(ConstAnyView view)
+  {
+    if (view.TypeId() != NGIN::Reflection::detail::TypeIdOf<C>())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "view type mismatch"});
+    return Adapter<C>{view.template Cast<C>()};
+  }
+
 } // namespace NGIN::Reflection::Adapters
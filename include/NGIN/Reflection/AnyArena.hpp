@@ -0,0 +1,65 @@
+// AnyArena.hpp
+// Thread-local monotonic storage for heap spills of reflection-produced Any values
+#pragma once
+
+#include <NGIN/Primitives.hpp>
+
+namespace NGIN::Reflection
+{
+  namespace detail
+  {
+    // Heap allocator of NGIN::Reflection::Any. Serves spills from the innermost AnyArenaScope
+    // of the calling thread, or the system allocator when none is active. Each block is tagged
+    // with its origin, so an Any may be destroyed on any thread or outside the scope that
+    // produced it, as long as arena blocks are not used after their scope has ended.
+    struct AnyArenaAllocator
+    {
+      void *Allocate(NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept;
+      void Deallocate(void *ptr, NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept;
+    };
+  } // namespace detail
+
+  // Routes Any heap spills on this thread into a monotonic buffer until the scope ends.
+  // Field::GetAny, Property::GetAny, Invoke and Construct results larger than the Any small
+  // buffer then cost a pointer bump instead of a system allocation, and freeing them is a
+  // no-op. Any values holding spilled payloads must be destroyed before the scope ends.
+  // Scopes nest; the innermost one serves allocations. Not movable.
+  class AnyArenaScope
+  {
+  public:
+    explicit AnyArenaScope(NGIN::UIntSize chunkBytes = 64 * 1024) noexcept;
+    ~AnyArenaScope();
+    AnyArenaScope(const AnyArenaScope &) = delete;
+    AnyArenaScope &operator=(const AnyArenaScope &) = delete;
+
+    // Bytes handed out so far, including alignment padding.
+    [[nodiscard]] NGIN::UIntSize BytesUsed() const noexcept { return m_used; }
+
+  private:
+    friend struct detail::AnyArenaAllocator;
+    struct Chunk
+    {
+      Chunk *next;
+      NGIN::UIntSize size;
+    };
+
+    void *Allocate(NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept;
+
+    AnyArenaScope *m_previous{nullptr};
+    Chunk *m_chunks{nullptr};
+    unsigned char *m_cursor{nullptr};
+    unsigned char *m_end{nullptr};
+    NGIN::UIntSize m_chunkBytes{0};
+    NGIN::UIntSize m_used{0};
+  };
+
+  // Process-wide counters of Any heap spills, split by where they were served.
+  struct AnyArenaStats
+  {
+    NGIN::UInt64 arenaAllocations{0};
+    NGIN::UInt64 heapAllocations{0};
+  };
+  [[nodiscard]] AnyArenaStats GetAnyArenaStats() noexcept;
+  void ResetAnyArenaStats() noexcept;
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,365 @@
+// BinarySerializer.hpp
+// Plan-compiled binary serialization of reflected objects into caller buffers
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+#include <NGIN/Reflection/Adapters.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace NGIN::Reflection
+{
+  // Appends to a caller buffer. Once the buffer is full further writes are dropped but still
+  // counted, so Required() tells how large a retry buffer must be.
+  class BinaryWriter
+  {
+  public:
+    explicit BinaryWriter(std::span<std::byte> buffer) noexcept : m_buffer(buffer) {}
+
+    void Write(const void *data, NGIN::UIntSize bytes) noexcept
+    {
+      if (!m_overflow && m_required + bytes <= m_buffer.size())
+        std::memcpy(m_buffer.data() + m_required, data, bytes);
+      else
+        m_overflow = true;
+      m_required += bytes;
+    }
+
+    [[nodiscard]] NGIN::UIntSize Written() const noexcept { return m_overflow ? 0 : m_required; }
+    [[nodiscard]] NGIN::UIntSize Required() const noexcept { return m_required; }
+    [[nodiscard]] bool Overflowed() const noexcept { return m_overflow; }
+
+  private:
+    std::span<std::byte> m_buffer;
+    NGIN::UIntSize m_required{0};
+    bool m_overflow{false};
+  };
+
+  // Consumes a caller buffer; a read past the end fails and leaves the reader failed.
+  class BinaryReader
+  {
+  public:
+    explicit BinaryReader(std::span<const std::byte> buffer) noexcept : m_buffer(buffer) {}
+
+    [[nodiscard]] bool Read(void *data, NGIN::UIntSize bytes) noexcept
+    {
+      if (m_failed || bytes > Remaining())
+      {
+        m_failed = true;
+        return false;
+      }
+      std::memcpy(data, m_buffer.data() + m_offset, bytes);
+      m_offset += bytes;
+      return true;
+    }
+
+    [[nodiscard]] NGIN::UIntSize Consumed() const noexcept { return m_offset; }
+    [[nodiscard]] NGIN::UIntSize Remaining() const noexcept { return m_buffer.size() - m_offset; }
+    [[nodiscard]] bool Failed() const noexcept { return m_failed; }
+
+  private:
+    std::span<const std::byte> m_buffer;
+    NGIN::UIntSize m_offset{0};
+    bool m_failed{false};
+  };
+
+  // Serializes reflected objects field by field through plans compiled once per type:
+  //   - runs of trivially copyable fields adjacent in memory become one memcpy span;
+  //   - strings, sequences and maps (as classified by the Adapters) use per-field codecs
+  //     generated at registration, writing a UInt64 count before their elements (only in
+  //     builds with NGIN_REFLECTION_ENABLE_FIELD_CODECS; otherwise such a field makes the
+  //     plan fail with "field type is not serializable");
+  //   - other reflected members recurse into the plan of their own type.
+  // Plans are dropped when detail::RegistryEpoch() moves (module unload, ABI merge), and
+  // running a plan takes no registry lock. The format is native-endian and meant for round
+  // trips between builds with the same field layout. Padding between the reflected fields is
+  // skipped, but a trivially copyable member is written as its sizeof(T) raw bytes: padding
+  // inside a nested trivially copyable struct, and pointer values, go into the output as is.
+  // A serializer is not thread-safe; keep one per thread.
+  class BinarySerializer
+  {
+  public:
+    BinarySerializer();
+    ~BinarySerializer();
+    BinarySerializer(BinarySerializer &&) noexcept;
+    BinarySerializer &operator=(BinarySerializer &&) noexcept;
+    BinarySerializer(const BinarySerializer &) = delete;
+    BinarySerializer &operator=(const BinarySerializer &) = delete;
+
+    // Returns the bytes written, or InvalidArgument "buffer too small" (see BinaryWriter::Required).
+    [[nodiscard]] std::expected<NGIN::UIntSize, Error> Write(Type type, const void *obj, std::span<std::byte> buffer);
+    // Returns the bytes consumed.
+    [[nodiscard]] std::expected<NGIN::UIntSize, Error> Read(Type type, void *obj, std::span<const std::byte> buffer);
+
+    // Streaming forms: several objects can share one writer/reader.
+    [[nodiscard]] std::expected<void, Error> Write(Type type, const void *obj, BinaryWriter &out);
+    [[nodiscard]] std::expected<void, Error> Read(Type type, void *obj, BinaryReader &in);
+
+    template <class T>
+    [[nodiscard]] std::expected<void, Error> Write(const T &obj, BinaryWriter &out)
+    {
+      Prepare<T>();
+      return WriteObject(detail::TypeIdOf<T>(), std::addressof(obj), out);
+    }
+    template <class T>
+    [[nodiscard]] std::expected<void, Error> Read(T &obj, BinaryReader &in)
+    {
+      Prepare<T>();
+      return ReadObject(detail::TypeIdOf<T>(), std::addressof(obj), in);
+    }
+
+    // By registered type id; used by element codecs for reflected element types.
+    [[nodiscard]] std::expected<void, Error> WriteObject(NGIN::UInt64 typeId, const void *obj, BinaryWriter &out);
+    [[nodiscard]] std::expected<void, Error> ReadObject(NGIN::UInt64 typeId, void *obj, BinaryReader &in);
+
+    // Number of compiled plans (one per reached type).
+    [[nodiscard]] NGIN::UIntSize PlanCount() const noexcept;
+    void Clear() noexcept;
+
+  private:
+    struct State;
+    // Register T on first use; later calls only probe the plan table.
+    template <class T>
+    void Prepare()
+    {
+      if (!HasPlan(detail::TypeIdOf<T>()))
+        (void)GetType<T>();
+    }
+    [[nodiscard]] bool HasPlan(NGIN::UInt64 typeId) const noexcept;
+    std::expected<NGIN::UInt32, Error> PlanFor(NGIN::UInt64 typeId);
+    std::expected<void, Error> RunWrite(NGIN::UInt32 plan, const void *obj, BinaryWriter &out);
+    std::expected<void, Error> RunRead(NGIN::UInt32 plan, void *obj, BinaryReader &in);
+
+    std::unique_ptr<State> m_state;
+  };
+
+  namespace detail
+  {
+    template <class T>
+    struct IsBasicString : std::false_type
+    {
+    };
+    template <class C, class Tr, class A>
+    struct IsBasicString<std::basic_string<C, Tr, A>> : std::true_type
+    {
+    };
+
+    // Element type of a sequence. Prefers value_type so std::vector<bool> does not expose its
+    // proxy reference.
+    template <class C>
+    struct SequenceElem
+    {
+      using type = std::remove_cvref_t<decltype(std::declval<const C &>()[0])>;
+    };
+    template <class C>
+      requires requires { typename C::value_type; }
+    struct SequenceElem<C>
+    {
+      using type = typename C::value_type;
+    };
+    template <class C>
+    using SequenceElemT = typename SequenceElem<C>::type;
+
+    template <class C>
+    NGIN::UIntSize ContainerSize(const C &c)
+    {
+      if constexpr (requires { c.size(); })
+        return static_cast<NGIN::UIntSize>(c.size());
+      else
+        return static_cast<NGIN::UIntSize>(c.Size());
+    }
+
+    template <class C>
+    void ContainerClear(C &c)
+    {
+      if constexpr (requires { c.clear(); })
+        c.clear();
+      else
+        c.Clear();
+    }
+
+    template <class C, class E>
+    void ContainerPushBack(C &c, E &&e)
+    {
+      if constexpr (requires { c.push_back(std::forward<E>(e)); })
+        c.push_back(std::forward<E>(e));
+      else
+        c.PushBack(std::forward<E>(e));
+    }
+
+    // Members that need a codec thunk; trivially copyable members are copied by the plan and
+    // other classes recurse through their own plan.
+    template <class T>
+    inline constexpr bool NeedsBinaryCodec = !std::is_trivially_copyable_v<T> &&
+                                             (IsBasicString<T>::value || Adapters::is_sequence_v<T> || Adapters::is_map_v<T>);
+
+    inline Error TruncatedInput() noexcept
+    {
+      return Error{ErrorCode::InvalidArgument, "binary input truncated"};
+    }
+
+    template <class T>
+    std::expected<void, Error> EncodeBinary(const T &v, BinarySerializer &s, BinaryWriter &w)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        w.Write(std::addressof(v), sizeof(T));
+        return {};
+      }
+      else if constexpr (IsBasicString<T>::value)
+      {
+        const NGIN::UInt64 n = v.size();
+        w.Write(&n, sizeof(n));
+        w.Write(v.data(), v.size() * sizeof(typename T::value_type));
+        return {};
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        const auto size = ContainerSize(v);
+        const NGIN::UInt64 n = size;
+        w.Write(&n, sizeof(n));
+        if constexpr (std::is_trivially_copyable_v<Elem> && requires { v.data(); })
+        {
+          w.Write(v.data(), size * sizeof(Elem));
+          return {};
+        }
+        for (NGIN::UIntSize i = 0; i < size; ++i)
+        {
+          const Elem &e = v[i];
+          if (auto r = EncodeBinary(e, s, w); !r.has_value())
+            return r;
+        }
+        return {};
+      }
+      else if constexpr (Adapters::is_map_v<T>)
+      {
+        const NGIN::UInt64 n = v.size();
+        w.Write(&n, sizeof(n));
+        for (const auto &[key, value] : v)
+        {
+          if (auto r = EncodeBinary(key, s, w); !r.has_value())
+            return r;
+          if (auto r = EncodeBinary(value, s, w); !r.has_value())
+            return r;
+        }
+        return {};
+      }
+      else
+      {
+        return s.WriteObject(TypeIdOf<T>(), std::addressof(v), w);
+      }
+    }
+
+    template <class T>
+    std::expected<void, Error> DecodeBinary(T &v, BinarySerializer &s, BinaryReader &r)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        if (!r.Read(std::addressof(v), sizeof(T)))
+          return std::unexpected(TruncatedInput());
+        return {};
+      }
+      else if constexpr (IsBasicString<T>::value)
+      {
+        NGIN::UInt64 n = 0;
+        if (!r.Read(&n, sizeof(n)) || n > r.Remaining() / sizeof(typename T::value_type))
+          return std::unexpected(TruncatedInput());
+        v.resize(static_cast<std::size_t>(n));
+        if (!r.Read(v.data(), v.size() * sizeof(typename T::value_type)))
+          return std::unexpected(TruncatedInput());
+        return {};
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        NGIN::UInt64 n = 0;
+        if (!r.Read(&n, sizeof(n)) || n > r.Remaining())
+          return std::unexpected(TruncatedInput());
+        if constexpr (std::is_trivially_copyable_v<Elem> && requires { v.resize(std::size_t{}); v.data(); })
+        {
+          if (n > r.Remaining() / sizeof(Elem))
+            return std::unexpected(TruncatedInput());
+          v.resize(static_cast<std::size_t>(n));
+          if (!r.Read(v.data(), v.size() * sizeof(Elem)))
+            return std::unexpected(TruncatedInput());
+          return {};
+        }
+        ContainerClear(v);
+        for (NGIN::UInt64 i = 0; i < n; ++i)
+        {
+          Elem e{};
+          if (auto res = DecodeBinary(e, s, r); !res.has_value())
+            return res;
+          ContainerPushBack(v, std::move(e));
+        }
+        return {};
+      }
+      else if constexpr (Adapters::is_map_v<T>)
+      {
+        NGIN::UInt64 n = 0;
+        if (!r.Read(&n, sizeof(n)) || n > r.Remaining())
+          return std::unexpected(TruncatedInput());
+        v.clear();
+        for (NGIN::UInt64 i = 0; i < n; ++i)
+        {
+          typename T::key_type key{};
+          typename T::mapped_type value{};
+          if (auto res = DecodeBinary(key, s, r); !res.has_value())
+            return res;
+          if (auto res = DecodeBinary(value, s, r); !res.has_value())
+            return res;
+          v.emplace(std::move(key), std::move(value));
+        }
+        return {};
+      }
+      else
+      {
+        return s.ReadObject(TypeIdOf<T>(), std::addressof(v), r);
+      }
+    }
+
+    // Register self-describing types (classes and enums) reachable from a field, so serializer
+    // plans and element codecs can find them by type id without the caller calling GetType first.
+    template <class T>
+    void RegisterFieldDependencies(ModuleId moduleId)
+    {
+      if constexpr (IsBasicString<T>::value)
+      {
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        RegisterFieldDependencies<SequenceElemT<T>>(moduleId);
+      }
+      else if constexpr (Adapters::is_map_v<T>)
+      {
+        RegisterFieldDependencies<typename T::key_type>(moduleId);
+        RegisterFieldDependencies<typename T::mapped_type>(moduleId);
+      }
+      else if constexpr (HasNginReflectWithTypeBuilder<T> || HasDescribeWithTypeBuilder<T>)
+      {
+        EnsureRegistered<T>(moduleId);
+      }
+    }
+
+    template <class T>
+    std::expected<void, Error> EncodeBinaryThunk(const void *member, BinarySerializer &s, BinaryWriter &w)
+    {
+      return EncodeBinary(*static_cast<const T *>(member), s, w);
+    }
+
+    template <class T>
+    std::expected<void, Error> DecodeBinaryThunk(void *member, BinarySerializer &s, BinaryReader &r)
+    {
+      return DecodeBinary(*static_cast<T *>(member), s, r);
+    }
+  } // namespace detail
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,112 @@
+// CallSite.hpp
+// Polymorphic inline cache for invoking a method by name from dynamic call sites
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <array>
+#include <expected>
+#include <span>
+#include <string_view>
+
+namespace NGIN::Reflection
+{
+
+  // A CallSite caches resolved overloads for one (method name) call location, e.g. one
+  // bytecode instruction in a script interpreter. Entries are keyed by the receiver type
+  // handle and the argument type ids; a hit calls the method thunk directly without taking
+  // the registry lock, hashing the name or allocating. Misses fall back to
+  // Type::ResolveMethod and fill the cache (round-robin replacement once full).
+  //
+  // The whole cache is dropped when detail::RegistryEpoch() changes (new fields, methods,
+  // constructors, functions or conversions, module unload, ABI merge). A CallSite is not
+  // thread-safe; embed one per call location per interpreter thread. The name must outlive
+  // the CallSite.
+  class CallSite
+  {
+  public:
+    static constexpr NGIN::UIntSize Capacity = 4;
+    static constexpr NGIN::UIntSize MaxArgs = 8; // calls with more arguments are never cached
+
+    CallSite() = default;
+    explicit CallSite(std::string_view name) noexcept : m_name(name) {}
+
+    [[nodiscard]] std::string_view Name() const noexcept { return m_name; }
+
+    [[nodiscard]] std::expected<Any, Error> Invoke(const Type &receiver, void *obj, const Any *args, NGIN::UIntSize count)
+    {
+      if (m_epoch == detail::RegistryEpoch())
+      {
+        const auto h = receiver.Handle();
+        for (NGIN::UInt32 e = 0; e < m_size; ++e)
+        {
+          const auto &entry = m_entries[e];
+          if (entry.typeIndex == h.index && entry.typeGeneration == h.generation && Matches(entry, args, count))
+          {
+            ++m_hits;
+            if (entry.convertedThunk)
+              return entry.convertedThunk(obj, args, count, entry.converters.data());
+            return entry.thunk(obj, args, count);
+          }
+        }
+      }
+      return InvokeSlow(receiver, obj, args, count);
+    }
+
+    [[nodiscard]] std::expected<Any, Error> Invoke(const Type &receiver, void *obj, std::span<const Any> args)
+    {
+      return Invoke(receiver, obj, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+
+    [[nodiscard]] NGIN::UIntSize EntryCount() const noexcept { return m_size; }
+    [[nodiscard]] NGIN::UInt64 Hits() const noexcept { return m_hits; }
+    [[nodiscard]] NGIN::UInt64 Misses() const noexcept { return m_misses; }
+
+    void Reset() noexcept
+    {
+      m_size = 0;
+      m_next = 0;
+      m_epoch = 0;
+    }
+
+  private:
+    using Thunk = std::expected<Any, Error> (*)(void *, const Any *, NGIN::UIntSize);
+    using ConvertedThunk = std::expected<Any, Error> (*)(void *, const Any *, NGIN::UIntSize, const detail::ArgConverter *);
+
+    struct Entry
+    {
+      NGIN::UInt32 typeIndex{static_cast<NGIN::UInt32>(-1)};
+      NGIN::UInt32 typeGeneration{0};
+      NGIN::UInt32 argCount{0};
+      NGIN::UInt32 mutableViewMask{0};
+      std::array<NGIN::UInt64, MaxArgs> argTypeIds{};
+      std::array<detail::ArgConverter, MaxArgs> converters{};
+      Thunk thunk{nullptr};
+      ConvertedThunk convertedThunk{nullptr}; // set when some argument is converted
+    };
+
+    static bool Matches(const Entry &entry, const Any *args, NGIN::UIntSize count)
+    {
+      if (entry.argCount != count)
+        return false;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        if (detail::ArgTypeId(args[i]) != entry.argTypeIds[i] ||
+            detail::ArgIsMutableView(args[i]) != (((entry.mutableViewMask >> i) & 1u) != 0))
+          return false;
+      }
+      return true;
+    }
+
+    std::expected<Any, Error> InvokeSlow(const Type &receiver, void *obj, const Any *args, NGIN::UIntSize count);
+
+    std::string_view m_name{};
+    NGIN::UInt64 m_epoch{0};
+    std::array<Entry, Capacity> m_entries{};
+    NGIN::UInt32 m_size{0};
+    NGIN::UInt32 m_next{0};
+    NGIN::UInt64 m_hits{0};
+    NGIN::UInt64 m_misses{0};
+  };
+
+} // namespace NGIN::Reflection
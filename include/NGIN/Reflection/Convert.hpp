@@ -8,6 +8,10 @@
 
 #include <type_traits>
 #include <expected>
+#include <optional>
+#include <utility>
+#include <memory>
+#include <new>
 
 #include <NGIN/Reflection/Types.hpp>
 
@@ -17,6 +21,43 @@ namespace NGIN::Reflection::detail
   template <class T>
   inline constexpr bool is_numeric_v = std::is_arithmetic_v<std::remove_cv_t<std::remove_reference_t<T>>>;
 
+  // Arithmetic conversion from a source holding type id `tid`. Src is Any or ConstAnyView.
+  template <class Dest, class Src>
+  inline std::expected<Dest, Error> ConvertArithmetic(NGIN::UInt64 tid, const Src &src)
+  {
+    if (tid == TypeIdOf<bool>())
+      return static_cast<Dest>(src.template Cast<bool>());
+    if (tid == TypeIdOf<signed char>())
+      return static_cast<Dest>(src.template Cast<signed char>());
+    if (tid == TypeIdOf<unsigned char>())
+      return static_cast<Dest>(src.template Cast<unsigned char>());
+    if (tid == TypeIdOf<char>())
+      return static_cast<Dest>(src.template Cast<char>());
+    if (tid == TypeIdOf<short>())
+      return static_cast<Dest>(src.template Cast<short>());
+    if (tid == TypeIdOf<unsigned short>())
+      return static_cast<Dest>(src.template Cast<unsigned short>());
+    if (tid == TypeIdOf<int>())
+      return static_cast<Dest>(src.template Cast<int>());
+    if (tid == TypeIdOf<unsigned int>())
+      return static_cast<Dest>(src.template Cast<unsigned int>());
+    if (tid == TypeIdOf<long>())
+      return static_cast<Dest>(src.template Cast<long>());
+    if (tid == TypeIdOf<unsigned long>())
+      return static_cast<Dest>(src.template Cast<unsigned long>());
+    if (tid == TypeIdOf<long long>())
+      return static_cast<Dest>(src.template Cast<long long>());
+    if (tid == TypeIdOf<unsigned long long>())
+      return static_cast<Dest>(src.template Cast<unsigned long long>());
+    if (tid == TypeIdOf<float>())
+      return static_cast<Dest>(src.template Cast<float>());
+    if (tid == TypeIdOf<double>())
+      return static_cast<Dest>(src.template Cast<double>());
+    if (tid == TypeIdOf<long double>())
+      return static_cast<Dest>(src.template Cast<long double>());
+    return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type not convertible"});
+  }
+
   // Try to convert Any -> To (supports exact match, arithmetic conversions)
   template <class To>
   inline std::expected<std::remove_cv_t<std::remove_reference_t<To>>, Error>
@@ -30,38 +71,199 @@ namespace NGIN::Reflection::detail
     }
     if constexpr (is_numeric_v<Dest>)
     {
-      if (tid == TypeIdOf<bool>())
-        return static_cast<Dest>(src.template Cast<bool>());
-      if (tid == TypeIdOf<signed char>())
-        return static_cast<Dest>(src.template Cast<signed char>());
-      if (tid == TypeIdOf<unsigned char>())
-        return static_cast<Dest>(src.template Cast<unsigned char>());
-      if (tid == TypeIdOf<char>())
-        return static_cast<Dest>(src.template Cast<char>());
-      if (tid == TypeIdOf<short>())
-        return static_cast<Dest>(src.template Cast<short>());
-      if (tid == TypeIdOf<unsigned short>())
-        return static_cast<Dest>(src.template Cast<unsigned short>());
-      if (tid == TypeIdOf<int>())
-        return static_cast<Dest>(src.template Cast<int>());
-      if (tid == TypeIdOf<unsigned int>())
-        return static_cast<Dest>(src.template Cast<unsigned int>());
-      if (tid == TypeIdOf<long>())
-        return static_cast<Dest>(src.template Cast<long>());
-      if (tid == TypeIdOf<unsigned long>())
-        return static_cast<Dest>(src.template Cast<unsigned long>());
-      if (tid == TypeIdOf<long long>())
-        return static_cast<Dest>(src.template Cast<long long>());
-      if (tid == TypeIdOf<unsigned long long>())
-        return static_cast<Dest>(src.template Cast<unsigned long long>());
-      if (tid == TypeIdOf<float>())
-        return static_cast<Dest>(src.template Cast<float>());
-      if (tid == TypeIdOf<double>())
-        return static_cast<Dest>(src.template Cast<double>());
-      if (tid == TypeIdOf<long double>())
-        return static_cast<Dest>(src.template Cast<long double>());
+      return ConvertArithmetic<Dest>(tid, src);
+    }
+    return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type not convertible"});
+  }
+
+  // Same as ConvertAny, reading through a view of the source object.
+  template <class To>
+  inline std::expected<std::remove_cv_t<std::remove_reference_t<To>>, Error>
+  ConvertView(const ConstAnyView &src)
+  {
+    using Dest = std::remove_cv_t<std::remove_reference_t<To>>;
+    const auto tid = src.TypeId();
+    if (tid == TypeIdOf<Dest>())
+    {
+      return src.template Cast<Dest>();
+    }
+    if constexpr (is_numeric_v<Dest>)
+    {
+      return ConvertArithmetic<Dest>(tid, src);
     }
     return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type not convertible"});
   }
 
+  // Binds one reflected argument to a parameter of type P for a thunk call.
+  //   - AnyView arguments bind T& / const T& directly to the caller's object (no copy).
+  //   - ConstAnyView arguments bind const T& directly; they never bind T&.
+  //   - Owned values bind const T& in place; conversions and T&& parameters use local storage.
+  // Out-params (non-const T&) accept only an AnyView of exactly T.
+  template <class P>
+  class ArgSlot
+  {
+  public:
+    using Value = std::remove_cv_t<std::remove_reference_t<P>>;
+    static constexpr bool IsOut = IsOutParamV<P>;
+    static constexpr bool IsRvalue = std::is_rvalue_reference_v<P>;
+    using Pass = std::conditional_t<IsOut, Value &, std::conditional_t<IsRvalue, Value &&, const Value &>>;
+
+    // Bind allowing the arithmetic conversions of ConvertAny, then the cheapest registered
+    // user conversion (looked up under the registry read lock). Returns false if not bindable.
+    bool Bind(const Any &arg) { return BindImpl<true>(arg); }
+    // Bind only when the argument (or the object it views) is exactly Value.
+    bool BindExact(const Any &arg) { return BindImpl<false>(arg); }
+    // Bind through a converter chosen at resolve time; a null converter binds exactly.
+    bool BindConverted(const Any &arg, ArgConverter convert)
+    {
+      if (!convert)
+        return BindImpl<false>(arg);
+      return Own(convert, ArgData(arg));
+    }
+
+    Pass Get()
+    {
+      if constexpr (IsOut)
+        return *m_mut;
+      else if constexpr (IsRvalue)
+        return std::move(*m_owned);
+      else if constexpr (CanOwn)
+        return m_owned ? *m_owned : *m_ref;
+      else
+        return *m_ref;
+    }
+
+  private:
+    static constexpr bool CanOwn = std::is_copy_constructible_v<Value> && !std::is_abstract_v<Value>;
+    static_assert(CanOwn || !IsRvalue, "T&& parameters require a copy-constructible T");
+    using Storage = std::conditional_t<CanOwn, Value, char>;
+
+    template <bool AllowConvert>
+    bool BindImpl(const Any &arg)
+    {
+      const auto tid = arg.GetTypeId();
+      if (tid == TypeIdOf<AnyView>())
+      {
+        const auto &view = arg.template Cast<AnyView>();
+        if (view.TypeId() == TypeIdOf<Value>())
+        {
+          auto &ref = view.template Cast<Value>();
+          if constexpr (IsOut)
+          {
+            m_mut = &ref;
+            return true;
+          }
+          else
+          {
+            return Borrow(ref);
+          }
+        }
+        if constexpr (IsOut)
+          return false;
+        else
+          return Convert<AllowConvert>(static_cast<ConstAnyView>(view));
+      }
+      if constexpr (IsOut)
+      {
+        return false;
+      }
+      else
+      {
+        if (tid == TypeIdOf<ConstAnyView>())
+        {
+          const auto &view = arg.template Cast<ConstAnyView>();
+          if (view.TypeId() == TypeIdOf<Value>())
+            return Borrow(view.template Cast<Value>());
+          return Convert<AllowConvert>(view);
+        }
+        if (tid == TypeIdOf<Value>())
+          return Borrow(arg.template Cast<Value>());
+        if constexpr (AllowConvert && CanOwn)
+        {
+          auto conv = ConvertAny<Value>(arg);
+          if (!conv.has_value())
+            return BindUserConversion(tid, arg.Data());
+          m_owned.emplace(std::move(*conv));
+          return true;
+        }
+        return false;
+      }
+    }
+
+    // Store the result of `convert` applied to `src`.
+    bool Own(ArgConverter convert, const void *src)
+    {
+      if constexpr (std::is_arithmetic_v<Value> && !IsOut)
+      {
+        Value v;
+        convert(src, &v);
+        m_owned.emplace(v);
+        return true;
+      }
+      else if constexpr (CanOwn && !IsOut)
+      {
+        alignas(Value) unsigned char raw[sizeof(Value)];
+        convert(src, raw);
+        auto *tmp = std::launder(reinterpret_cast<Value *>(raw));
+        m_owned.emplace(std::move(*tmp));
+        tmp->~Value();
+        return true;
+      }
+      else
+      {
+        (void)convert;
+        (void)src;
+        return false;
+      }
+    }
+
+    // Fallback after the arithmetic conversions: a registered user conversion from `from`.
+    bool BindUserConversion(NGIN::UInt64 from, const void *src)
+    {
+      ArgConverter convert = nullptr;
+      {
+        [[maybe_unused]] auto lock = LockRegistryRead();
+        int cost = 0;
+        convert = FindUserConversion(from, TypeIdOf<Value>(), cost);
+      }
+      return convert && Own(convert, src);
+    }
+
+    bool Borrow(const Value &ref)
+    {
+      if constexpr (IsRvalue)
+      {
+        m_owned.emplace(ref);
+        return true;
+      }
+      else
+      {
+        m_ref = &ref;
+        return true;
+      }
+    }
+
+    template <bool AllowConvert>
+    bool Convert(const ConstAnyView &view)
+    {
+      if constexpr (AllowConvert && CanOwn)
+      {
+        auto conv = ConvertView<Value>(view);
+        if (!conv.has_value())
+          return BindUserConversion(view.TypeId(), view.Data());
+        m_owned.emplace(std::move(*conv));
+        return true;
+      }
+      else
+      {
+        (void)view;
+        return false;
+      }
+    }
+
+    Value *m_mut{nullptr};
+    const Value *m_ref{nullptr};
+    std::optional<Storage> m_owned{};
+  };
+
 } // namespace NGIN::Reflection::detail
@@ -0,0 +1,143 @@
+// Equality.hpp
+// Deep equality and hashing of reflected objects (see Type::Equals/Hash)
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+#include <NGIN/Reflection/Adapters.hpp>
+#include <NGIN/Reflection/BinarySerializer.hpp>
+
+#include <cstring>
+#include <expected>
+#include <type_traits>
+
+namespace NGIN::Reflection
+{
+  namespace detail
+  {
+    // Seeded hash over raw bytes; four independent 8-byte lanes per 32-byte block.
+    NGIN::UInt64 HashBytes(const void *data, NGIN::UIntSize size, NGIN::UInt64 seed) noexcept;
+
+    // By registered type id, through the type's equality plan; used for reflected elements.
+    std::expected<bool, Error> EqualObjects(NGIN::UInt64 typeId, const void *a, const void *b);
+    std::expected<NGIN::UInt64, Error> HashObject(NGIN::UInt64 typeId, const void *obj, NGIN::UInt64 seed);
+
+    template <class T>
+    std::expected<bool, Error> DeepEqual(const T &a, const T &b)
+    {
+      if constexpr (IsBytewise<T>)
+      {
+        return std::memcmp(std::addressof(a), std::addressof(b), sizeof(T)) == 0;
+      }
+      else if constexpr (IsBasicString<T>::value)
+      {
+        return a == b;
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        const auto size = ContainerSize(a);
+        if (size != ContainerSize(b))
+          return false;
+        if constexpr (IsBytewise<Elem> && requires { a.data(); })
+        {
+          return size == 0 || std::memcmp(a.data(), b.data(), size * sizeof(Elem)) == 0;
+        }
+        for (NGIN::UIntSize i = 0; i < size; ++i)
+        {
+          const Elem &ea = a[i];
+          const Elem &eb = b[i];
+          auto r = DeepEqual(ea, eb);
+          if (!r.has_value() || !*r)
+            return r;
+        }
+        return true;
+      }
+      else if constexpr (Adapters::is_map_v<T>)
+      {
+        if (a.size() != b.size())
+          return false;
+        for (const auto &[key, value] : a)
+        {
+          const auto it = b.find(key);
+          if (it == b.end())
+            return false;
+          auto r = DeepEqual(value, it->second);
+          if (!r.has_value() || !*r)
+            return r;
+        }
+        return true;
+      }
+      else
+      {
+        return EqualObjects(TypeIdOf<T>(), std::addressof(a), std::addressof(b));
+      }
+    }
+
+    // Consistent with DeepEqual: equal values hash equal. Maps combine their entries
+    // order-independently so unordered maps with the same contents agree.
+    template <class T>
+    std::expected<NGIN::UInt64, Error> DeepHash(const T &v, NGIN::UInt64 seed)
+    {
+      if constexpr (IsBytewise<T>)
+      {
+        return HashBytes(std::addressof(v), sizeof(T), seed);
+      }
+      else if constexpr (IsBasicString<T>::value)
+      {
+        return HashBytes(v.data(), v.size() * sizeof(typename T::value_type), seed);
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        const NGIN::UInt64 size = ContainerSize(v);
+        NGIN::UInt64 h = HashBytes(&size, sizeof(size), seed);
+        if constexpr (IsBytewise<Elem> && requires { v.data(); })
+        {
+          return HashBytes(v.data(), size * sizeof(Elem), h);
+        }
+        for (NGIN::UIntSize i = 0; i < size; ++i)
+        {
+          const Elem &e = v[i];
+          auto r = DeepHash(e, h);
+          if (!r.has_value())
+            return r;
+          h = *r;
+        }
+        return h;
+      }
+      else if constexpr (Adapters::is_map_v<T>)
+      {
+        NGIN::UInt64 sum = 0;
+        for (const auto &[key, value] : v)
+        {
+          auto kh = DeepHash(key, 0);
+          if (!kh.has_value())
+            return kh;
+          auto eh = DeepHash(value, *kh);
+          if (!eh.has_value())
+            return eh;
+          sum += *eh;
+        }
+        const NGIN::UInt64 words[2] = {static_cast<NGIN::UInt64>(v.size()), sum};
+        return HashBytes(words, sizeof(words), seed);
+      }
+      else
+      {
+        return HashObject(TypeIdOf<T>(), std::addressof(v), seed);
+      }
+    }
+
+    template <class T>
+    std::expected<bool, Error> DeepEqualThunk(const void *a, const void *b)
+    {
+      return DeepEqual(*static_cast<const T *>(a), *static_cast<const T *>(b));
+    }
+
+    template <class T>
+    std::expected<NGIN::UInt64, Error> DeepHashThunk(const void *v, NGIN::UInt64 seed)
+    {
+      return DeepHash(*static_cast<const T *>(v), seed);
+    }
+  } // namespace detail
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,40 @@
+// FieldDelta.hpp
+// Field-level diffs between two objects of one reflected type (see Type::Diff/ApplyPatch)
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace NGIN::Reflection
+{
+  // Changes that turn one object into another. Bit i of `mask` (word i / 64) is set when
+  // field i (FieldAt order) changed; `payload` holds the new values of the set fields in
+  // field order:
+  //   - trivially copyable fields: their bytes;
+  //   - strings and containers: the BinarySerializer encoding;
+  //   - reflected members: the nested mask words followed by the nested payload.
+  // Native-endian; meant for peers built with the same field layout.
+  struct FieldPatch
+  {
+    std::vector<NGIN::UInt64> mask;
+    std::vector<std::byte> payload;
+
+    [[nodiscard]] bool Empty() const noexcept
+    {
+      for (const auto word : mask)
+      {
+        if (word != 0)
+          return false;
+      }
+      return true;
+    }
+    void Clear() noexcept
+    {
+      mask.clear();
+      payload.clear();
+    }
+  };
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,112 @@
+// FieldPath.hpp
+// Dotted member paths ("transform.position.x") resolved once by Type::CompilePath
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <expected>
+#include <optional>
+#include <utility>
+
+namespace NGIN::Reflection
+{
+  // A nested member reached from a root object through a chain of reflected fields. When
+  // every hop has a recorded offset the chain collapses into one cumulative offset, and
+  // Resolve is a single pointer add; otherwise it walks a short list of offset and getter
+  // hops. Like FieldAccessor, a path holds thunks of the owning module and must not be used
+  // once that module is unloaded. CompilePath rejects fields that have neither an offset nor
+  // an accessor (possible after an ABI merge) with InvalidArgument.
+  class FieldPath
+  {
+  public:
+    FieldPath() = default;
+
+    [[nodiscard]] bool IsValid() const noexcept { return m_typeId != 0; }
+    // Type id of the member at the end of the path, and of the root it starts from.
+    [[nodiscard]] NGIN::UInt64 TypeId() const noexcept { return m_typeId; }
+    [[nodiscard]] NGIN::UInt64 RootTypeId() const noexcept { return m_rootTypeId; }
+    [[nodiscard]] NGIN::UIntSize Depth() const noexcept { return m_depth; }
+    // Offset of the member inside the root, when the path collapsed to one.
+    [[nodiscard]] std::optional<NGIN::UIntSize> Offset() const noexcept
+    {
+      if (m_offset == detail::kNoFieldOffset)
+        return std::nullopt;
+      return m_offset;
+    }
+
+    template <class T>
+    [[nodiscard]] bool Is() const noexcept
+    {
+      return m_typeId == detail::TypeIdOf<T>();
+    }
+
+    [[nodiscard]] void *Resolve(void *root) const noexcept
+    {
+      if (m_offset != detail::kNoFieldOffset)
+        return static_cast<unsigned char *>(root) + m_offset;
+      auto *owner = OwnerOf(root);
+      if (m_leafGet)
+        return m_leafGet(owner);
+      return static_cast<unsigned char *>(owner) + m_leafOffset;
+    }
+    [[nodiscard]] const void *Resolve(const void *root) const noexcept
+    {
+      return Resolve(const_cast<void *>(root));
+    }
+
+    // Unchecked typed access; T must be the member type (see Is<T>()).
+    template <class T>
+    [[nodiscard]] T &Get(void *root) const noexcept
+    {
+      return *static_cast<T *>(Resolve(root));
+    }
+    template <class T>
+    [[nodiscard]] const T &Get(const void *root) const noexcept
+    {
+      return *static_cast<const T *>(Resolve(root));
+    }
+    template <class T, class V>
+    void Set(void *root, V &&value) const
+    {
+      Get<T>(root) = std::forward<V>(value);
+    }
+
+    // Checked access through the member's Load/Store thunks.
+    [[nodiscard]] Any GetAny(const void *root) const;
+    [[nodiscard]] std::expected<void, Error> SetAny(void *root, const Any &value) const;
+
+  private:
+    friend class Type;
+
+    // p = get ? get(p) : p + offset. The hops lead to the leaf's owner; a collapsed path
+    // keeps them for the Load/Store thunks of GetAny/SetAny.
+    struct Hop
+    {
+      NGIN::UIntSize offset{0};
+      void *(*get)(void *){nullptr};
+    };
+
+    [[nodiscard]] void *OwnerOf(void *root) const noexcept
+    {
+      void *p = root;
+      for (NGIN::UIntSize i = 0; i < m_hops.Size(); ++i)
+      {
+        const auto &hop = m_hops[i];
+        p = hop.get ? hop.get(p) : static_cast<unsigned char *>(p) + hop.offset;
+      }
+      return p;
+    }
+
+    NGIN::Containers::Vector<Hop> m_hops;
+    NGIN::UIntSize m_offset{detail::kNoFieldOffset};
+    NGIN::UIntSize m_leafOffset{detail::kNoFieldOffset};
+    void *(*m_leafGet)(void *){nullptr};
+    Any (*m_load)(const void *){nullptr};
+    std::expected<void, Error> (*m_store)(void *, const Any &){nullptr};
+    NGIN::UInt64 m_typeId{0};
+    NGIN::UIntSize m_size{0};
+    NGIN::UInt64 m_rootTypeId{0};
+    NGIN::UIntSize m_depth{0};
+  };
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,410 @@
+// JsonSerializer.hpp
+// Streaming JSON reading/writing of reflected objects through per-type key plans
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+#include <NGIN/Reflection/Adapters.hpp>
+#include <NGIN/Reflection/BinarySerializer.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace NGIN::Reflection
+{
+  // Appends compact JSON to a caller string.
+  class JsonWriter
+  {
+  public:
+    explicit JsonWriter(std::string &out) noexcept : m_out(&out) {}
+
+    void Raw(char c) { m_out->push_back(c); }
+    void Raw(std::string_view text) { m_out->append(text); }
+
+    // Quoted string; escapes quotes, backslashes and control characters.
+    void String(std::string_view text);
+
+    template <class T>
+    void Number(T v)
+    {
+      char buf[64];
+      const auto r = std::to_chars(buf, buf + sizeof(buf), v);
+      m_out->append(buf, r.ptr);
+    }
+
+    [[nodiscard]] std::string &Output() noexcept { return *m_out; }
+
+  private:
+    std::string *m_out;
+  };
+
+  // Pull tokenizer over a JSON text. Every Read* skips leading whitespace; the first malformed
+  // token marks the reader failed and Consumed() then points at it.
+  class JsonReader
+  {
+  public:
+    // Deepest object/array nesting accepted, by SkipValue and by the decoders alike.
+    static constexpr NGIN::UIntSize kMaxDepth = 512;
+
+    explicit JsonReader(std::string_view text) noexcept : m_text(text) {}
+
+    // One level of object or array nesting, held while a decoder reads it. Past kMaxDepth it
+    // marks the reader failed and converts to false.
+    class Nesting
+    {
+    public:
+      explicit Nesting(JsonReader &reader) noexcept : m_reader(reader), m_entered(reader.m_depth < kMaxDepth)
+      {
+        if (m_entered)
+          ++m_reader.m_depth;
+        else
+          m_reader.Fail();
+      }
+      ~Nesting()
+      {
+        if (m_entered)
+          --m_reader.m_depth;
+      }
+      Nesting(const Nesting &) = delete;
+      Nesting &operator=(const Nesting &) = delete;
+
+      explicit operator bool() const noexcept { return m_entered; }
+
+    private:
+      JsonReader &m_reader;
+      bool m_entered;
+    };
+
+    void SkipWhitespace() noexcept
+    {
+      while (m_pos < m_text.size() && (m_text[m_pos] == ' ' || m_text[m_pos] == '\n' || m_text[m_pos] == '\r' || m_text[m_pos] == '\t'))
+        ++m_pos;
+    }
+
+    // Next significant character, or '\0' at the end of input.
+    [[nodiscard]] char Peek() noexcept
+    {
+      SkipWhitespace();
+      return m_pos < m_text.size() ? m_text[m_pos] : '\0';
+    }
+
+    // Consumes `c` if it is the next significant character.
+    [[nodiscard]] bool Consume(char c) noexcept
+    {
+      if (Peek() != c)
+        return false;
+      ++m_pos;
+      return true;
+    }
+
+    [[nodiscard]] bool Expect(char c) noexcept
+    {
+      if (Consume(c))
+        return true;
+      return Fail();
+    }
+
+    // A string without escapes is returned as a view into the input; otherwise it is decoded
+    // into `scratch` and the view refers to that.
+    [[nodiscard]] bool ReadString(std::string_view &out, std::string &scratch);
+    [[nodiscard]] bool ReadString(std::string &out);
+    // The characters of a number token, unvalidated; callers parse them with from_chars.
+    [[nodiscard]] bool ReadNumber(std::string_view &out) noexcept;
+    [[nodiscard]] bool ReadBool(bool &out) noexcept;
+    // Skips one value of any kind (used for unknown keys).
+    [[nodiscard]] bool SkipValue();
+
+    [[nodiscard]] NGIN::UIntSize Consumed() const noexcept { return m_pos; }
+    [[nodiscard]] bool Failed() const noexcept { return m_failed; }
+    bool Fail() noexcept
+    {
+      m_failed = true;
+      return false;
+    }
+
+  private:
+    bool ReadLiteral(std::string_view literal) noexcept;
+    bool SkipString() noexcept;
+    bool SkipValue(NGIN::UIntSize depth);
+
+    std::string_view m_text;
+    NGIN::UIntSize m_pos{0};
+    NGIN::UIntSize m_depth{0};
+    bool m_failed{false};
+  };
+
+  // Reads and writes reflected objects as JSON without building a document tree. Each type
+  // gets a plan on first use: pre-rendered `"name":` keys for writing and a perfect hash from
+  // key to field for reading, so a key costs one hash and one compare. Bool, arithmetic and
+  // string fields are recognized by type id and go through to_chars/from_chars straight
+  // from/into the member; sequence and map fields use the codecs generated at registration
+  // with NGIN_REFLECTION_ENABLE_FIELD_CODECS. Enums are written by name and other reflected
+  // members recurse into their own plan. Unknown keys are skipped and missing keys leave the
+  // member untouched; input nested deeper than JsonReader::kMaxDepth is malformed. Plans are
+  // dropped when detail::RegistryEpoch() moves, and running one takes no registry lock. A
+  // serializer is not thread-safe; keep one per thread.
+  class JsonSerializer
+  {
+  public:
+    JsonSerializer();
+    ~JsonSerializer();
+    JsonSerializer(JsonSerializer &&) noexcept;
+    JsonSerializer &operator=(JsonSerializer &&) noexcept;
+    JsonSerializer(const JsonSerializer &) = delete;
+    JsonSerializer &operator=(const JsonSerializer &) = delete;
+
+    // Appends the object to `out`.
+    [[nodiscard]] std::expected<void, Error> Write(Type type, const void *obj, std::string &out);
+    // Returns the characters consumed, including trailing whitespace.
+    [[nodiscard]] std::expected<NGIN::UIntSize, Error> Read(Type type, void *obj, std::string_view json);
+
+    // Streaming forms: several values can share one writer/reader.
+    [[nodiscard]] std::expected<void, Error> Write(Type type, const void *obj, JsonWriter &out);
+    [[nodiscard]] std::expected<void, Error> Read(Type type, void *obj, JsonReader &in);
+
+    template <class T>
+    [[nodiscard]] std::expected<void, Error> Write(const T &obj, std::string &out)
+    {
+      JsonWriter w{out};
+      return Write(obj, w);
+    }
+    template <class T>
+    [[nodiscard]] std::expected<void, Error> Write(const T &obj, JsonWriter &out)
+    {
+      Prepare<T>();
+      return WriteObject(detail::TypeIdOf<T>(), std::addressof(obj), out);
+    }
+    template <class T>
+    [[nodiscard]] std::expected<void, Error> Read(T &obj, JsonReader &in)
+    {
+      Prepare<T>();
+      return ReadObject(detail::TypeIdOf<T>(), std::addressof(obj), in);
+    }
+
+    // By registered type id; used by element codecs for reflected element types.
+    [[nodiscard]] std::expected<void, Error> WriteObject(NGIN::UInt64 typeId, const void *obj, JsonWriter &out);
+    [[nodiscard]] std::expected<void, Error> ReadObject(NGIN::UInt64 typeId, void *obj, JsonReader &in);
+
+    // Number of compiled plans (one per reached type).
+    [[nodiscard]] NGIN::UIntSize PlanCount() const noexcept;
+    void Clear() noexcept;
+
+  private:
+    struct State;
+    // Register T on first use; later calls only probe the plan table.
+    template <class T>
+    void Prepare()
+    {
+      if (!HasPlan(detail::TypeIdOf<T>()))
+        (void)GetType<T>();
+    }
+    [[nodiscard]] bool HasPlan(NGIN::UInt64 typeId) const noexcept;
+    std::expected<NGIN::UInt32, Error> PlanFor(NGIN::UInt64 typeId);
+    std::expected<void, Error> RunWrite(NGIN::UInt32 plan, const void *obj, JsonWriter &out);
+    std::expected<void, Error> RunRead(NGIN::UInt32 plan, void *obj, JsonReader &in);
+
+    std::unique_ptr<State> m_state;
+  };
+
+  namespace detail
+  {
+    template <class T>
+    inline constexpr bool IsJsonNumber = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    // Map keys become JSON object keys: strings as-is, numbers in their decimal form.
+    template <class K>
+    inline constexpr bool IsJsonKey = std::is_same_v<K, std::string> || IsJsonNumber<K>;
+
+    template <class T>
+    struct IsJsonMap : std::false_type
+    {
+    };
+    template <class T>
+      requires Adapters::is_map_v<T>
+    struct IsJsonMap<T> : std::bool_constant<IsJsonKey<typename T::key_type>>
+    {
+    };
+
+    // Members that need a codec thunk. The plan handles scalars and strings by type id; enums
+    // and other classes go through their own plan.
+    template <class T>
+    inline constexpr bool NeedsJsonCodec = Adapters::is_sequence_v<T> || IsJsonMap<T>::value;
+
+    inline Error MalformedJson() noexcept
+    {
+      return Error{ErrorCode::InvalidArgument, "malformed json"};
+    }
+
+    template <class T>
+    bool ParseJsonNumber(std::string_view token, T &out) noexcept
+    {
+      const auto r = std::from_chars(token.data(), token.data() + token.size(), out);
+      return r.ec == std::errc{} && r.ptr == token.data() + token.size();
+    }
+
+    template <class T>
+    std::expected<void, Error> EncodeJson(const T &v, JsonSerializer &s, JsonWriter &w)
+    {
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        w.Raw(v ? std::string_view{"true"} : std::string_view{"false"});
+        return {};
+      }
+      else if constexpr (IsJsonNumber<T>)
+      {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+          if (!std::isfinite(v))
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "non-finite number in json"});
+        }
+        w.Number(v);
+        return {};
+      }
+      else if constexpr (std::is_same_v<T, std::string>)
+      {
+        w.String(v);
+        return {};
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        const auto size = ContainerSize(v);
+        w.Raw('[');
+        for (NGIN::UIntSize i = 0; i < size; ++i)
+        {
+          if (i > 0)
+            w.Raw(',');
+          const Elem &e = v[i];
+          if (auto r = EncodeJson(e, s, w); !r.has_value())
+            return r;
+        }
+        w.Raw(']');
+        return {};
+      }
+      else if constexpr (IsJsonMap<T>::value)
+      {
+        w.Raw('{');
+        bool first = true;
+        for (const auto &[key, value] : v)
+        {
+          if (!first)
+            w.Raw(',');
+          first = false;
+          if constexpr (std::is_same_v<typename T::key_type, std::string>)
+          {
+            w.String(key);
+          }
+          else
+          {
+            w.Raw('"');
+            w.Number(key);
+            w.Raw('"');
+          }
+          w.Raw(':');
+          if (auto r = EncodeJson(value, s, w); !r.has_value())
+            return r;
+        }
+        w.Raw('}');
+        return {};
+      }
+      else
+      {
+        return s.WriteObject(TypeIdOf<T>(), std::addressof(v), w);
+      }
+    }
+
+    template <class T>
+    std::expected<void, Error> DecodeJson(T &v, JsonSerializer &s, JsonReader &r)
+    {
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        if (!r.ReadBool(v))
+          return std::unexpected(MalformedJson());
+        return {};
+      }
+      else if constexpr (IsJsonNumber<T>)
+      {
+        std::string_view token;
+        if (!r.ReadNumber(token) || !ParseJsonNumber(token, v))
+          return std::unexpected(MalformedJson());
+        return {};
+      }
+      else if constexpr (std::is_same_v<T, std::string>)
+      {
+        if (!r.ReadString(v))
+          return std::unexpected(MalformedJson());
+        return {};
+      }
+      else if constexpr (Adapters::is_sequence_v<T>)
+      {
+        using Elem = SequenceElemT<T>;
+        JsonReader::Nesting nesting{r};
+        if (!nesting || !r.Expect('['))
+          return std::unexpected(MalformedJson());
+        ContainerClear(v);
+        if (r.Consume(']'))
+          return {};
+        do
+        {
+          Elem e{};
+          if (auto res = DecodeJson(e, s, r); !res.has_value())
+            return res;
+          ContainerPushBack(v, std::move(e));
+        } while (r.Consume(','));
+        if (!r.Expect(']'))
+          return std::unexpected(MalformedJson());
+        return {};
+      }
+      else if constexpr (IsJsonMap<T>::value)
+      {
+        JsonReader::Nesting nesting{r};
+        if (!nesting || !r.Expect('{'))
+          return std::unexpected(MalformedJson());
+        v.clear();
+        if (r.Consume('}'))
+          return {};
+        std::string scratch;
+        do
+        {
+          typename T::key_type key{};
+          std::string_view text;
+          if (!r.ReadString(text, scratch) || !r.Expect(':'))
+            return std::unexpected(MalformedJson());
+          if constexpr (std::is_same_v<typename T::key_type, std::string>)
+            key.assign(text);
+          else if (!ParseJsonNumber(text, key))
+            return std::unexpected(MalformedJson());
+          typename T::mapped_type value{};
+          if (auto res = DecodeJson(value, s, r); !res.has_value())
+            return res;
+          v.insert_or_assign(std::move(key), std::move(value));
+        } while (r.Consume(','));
+        if (!r.Expect('}'))
+          return std::unexpected(MalformedJson());
+        return {};
+      }
+      else
+      {
+        return s.ReadObject(TypeIdOf<T>(), std::addressof(v), r);
+      }
+    }
+
+    template <class T>
+    std::expected<void, Error> EncodeJsonThunk(const void *member, JsonSerializer &s, JsonWriter &w)
+    {
+      return EncodeJson(*static_cast<const T *>(member), s, w);
+    }
+
+    template <class T>
+    std::expected<void, Error> DecodeJsonThunk(void *member, JsonSerializer &s, JsonReader &r)
+    {
+      return DecodeJson(*static_cast<T *>(member), s, r);
+    }
+  } // namespace detail
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,87 @@
+// Mapper.hpp
+// Compiled field-by-name copies between two reflected types (see Mapper::Compile)
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <expected>
+
+namespace NGIN::Reflection
+{
+  // Copies the fields two reflected types have in common. Compile matches destination fields
+  // to source fields by name once:
+  //   - same type id, trivially copyable: a memcpy range; ranges that are contiguous in both
+  //     types merge (never across padding, which may hold a field in the other type);
+  //   - same type id otherwise: the member's copy assignment;
+  //   - different type ids: a value-preserving arithmetic conversion (short -> int, float ->
+  //     double, ...) or a registered user conversion into a trivially copyable destination,
+  //     or, when both sides are reflected classes, a nested mapping of their fields.
+  //     Narrowing pairs (int -> short, double -> float) are not mapped unless a user
+  //     conversion is registered for them.
+  // Destination fields without a match are left untouched. Matched fields that have neither
+  // an offset nor an accessor (possible after an ABI merge) fail Compile with
+  // InvalidArgument. Like FieldPath, a mapper holds thunks of the owning modules and must not
+  // be used once either module is unloaded.
+  class Mapper
+  {
+  public:
+    Mapper() = default;
+
+    [[nodiscard]] static std::expected<Mapper, Error> Compile(const Type &src, const Type &dst);
+    template <class Src, class Dst>
+    [[nodiscard]] static std::expected<Mapper, Error> Compile()
+    {
+      return Compile(GetType<Src>(), GetType<Dst>());
+    }
+
+    [[nodiscard]] bool IsValid() const noexcept { return m_srcTypeId != 0; }
+    [[nodiscard]] NGIN::UInt64 SourceTypeId() const noexcept { return m_srcTypeId; }
+    [[nodiscard]] NGIN::UInt64 TargetTypeId() const noexcept { return m_dstTypeId; }
+    // Destination fields the mapper writes, counting nested members' fields individually.
+    [[nodiscard]] NGIN::UIntSize MappedFieldCount() const noexcept { return m_mappedFields; }
+    // memcpy ranges left after merging.
+    [[nodiscard]] NGIN::UIntSize CopyRangeCount() const noexcept;
+
+    void Apply(const void *src, void *dst) const;
+    // `count` adjacent objects of each type (strided by Type::Size()).
+    void ApplyArray(const void *src, void *dst, NGIN::UIntSize count) const;
+
+  private:
+    enum class StepKind : NGIN::UInt8
+    {
+      Copy,    // memcpy of `size` bytes
+      Convert, // value-preserving or user ArgConverter into a trivially copyable destination
+      Assign,  // CopyAssign thunk
+      Nested,  // steps [first, first + count) on the member pair
+    };
+
+    struct Step
+    {
+      StepKind kind{StepKind::Copy};
+      NGIN::UIntSize srcOffset{0};
+      NGIN::UIntSize dstOffset{0};
+      NGIN::UIntSize size{0};
+      // Set when that side's owner has no recorded offsets.
+      const void *(*getConst)(const void *){nullptr};
+      void *(*getMut)(void *){nullptr};
+      detail::ArgConverter convert{nullptr};
+      void (*assign)(void *, const void *){nullptr};
+      NGIN::UInt32 first{0};
+      NGIN::UInt32 count{0};
+    };
+
+    struct Builder;
+
+    void Run(NGIN::UInt32 first, NGIN::UInt32 count, const void *src, void *dst) const;
+
+    NGIN::Containers::Vector<Step> m_steps;
+    NGIN::UInt32 m_rootFirst{0};
+    NGIN::UInt32 m_rootCount{0};
+    NGIN::UInt64 m_srcTypeId{0};
+    NGIN::UInt64 m_dstTypeId{0};
+    NGIN::UIntSize m_srcSize{0};
+    NGIN::UIntSize m_dstSize{0};
+    NGIN::UIntSize m_mappedFields{0};
+  };
+
+} // namespace NGIN::Reflection
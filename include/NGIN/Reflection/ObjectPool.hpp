@@ -0,0 +1,81 @@
+// ObjectPool.hpp
+// Slab storage for reflected objects constructed in place through Type thunks
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <expected>
+#include <memory>
+#include <span>
+
+namespace NGIN::Reflection
+{
+  // Stable reference to one pooled object; stale once the object is destroyed.
+  struct PoolHandle
+  {
+    NGIN::UInt32 index{static_cast<NGIN::UInt32>(-1)};
+    NGIN::UInt32 generation{0};
+    constexpr bool IsValid() const noexcept { return index != static_cast<NGIN::UInt32>(-1); }
+  };
+
+  namespace detail
+  {
+    struct PoolState;
+    // Destroy every live object in pools of the module's types. Called by UnregisterModule.
+    void ReleaseModulePools(ModuleId moduleId) noexcept;
+  } // namespace detail
+
+  // Objects of one reflected type, stored in slabs of `capacity` slots each. A slot is
+  // Type::Size() rounded up to Type::Alignment(), and slabs are allocated with that alignment.
+  // Objects never move, so pointers from Get() stay valid until the object is destroyed.
+  // Full pools grow by another slab.
+  //
+  // Objects are built with Type::ConstructAt and destroyed through the type's Destroy thunk.
+  // Destroying the pool destroys the remaining objects; unloading the type's module does the
+  // same and leaves the pool empty and unusable. A pool is not thread-safe, except that
+  // Create/Destroy/Clear are serialized against a module unload on another thread; Get() and
+  // the pointers it returned must not be used concurrently with that unload.
+  class ObjectPool
+  {
+  public:
+    ObjectPool() = default;
+    ~ObjectPool();
+    ObjectPool(ObjectPool &&other) noexcept;
+    ObjectPool &operator=(ObjectPool &&other) noexcept;
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool &operator=(const ObjectPool &) = delete;
+
+    [[nodiscard]] bool IsValid() const noexcept;
+    [[nodiscard]] Type GetType() const noexcept;
+    // Live objects.
+    [[nodiscard]] NGIN::UIntSize Size() const noexcept;
+    // Slots allocated across all slabs.
+    [[nodiscard]] NGIN::UIntSize Capacity() const noexcept;
+
+    [[nodiscard]] std::expected<PoolHandle, Error> Create(const Any *args, NGIN::UIntSize count);
+    [[nodiscard]] std::expected<PoolHandle, Error> Create(std::span<const Any> args)
+    {
+      return Create(args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+    std::expected<void, Error> Destroy(PoolHandle h);
+    // Destroy all live objects; slabs are kept for reuse.
+    void Clear() noexcept;
+
+    // Object storage, or nullptr for a stale handle.
+    [[nodiscard]] void *Get(PoolHandle h) const noexcept;
+    template <class T>
+    [[nodiscard]] T *Get(PoolHandle h) const noexcept
+    {
+      return static_cast<T *>(Get(h));
+    }
+
+  private:
+    friend class Type;
+    explicit ObjectPool(std::shared_ptr<detail::PoolState> state) noexcept;
+
+    // Shared only with a module unload in progress, which keeps the state alive while it
+    // destroys the objects.
+    std::shared_ptr<detail::PoolState> m_state;
+  };
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,186 @@
+// PlanCache.hpp
+// Per-type plan table and member addressing shared by the plan-compiled engines (serializers,
+// FieldDelta, Equality)
+#pragma once
+
+#include <NGIN/Reflection/Registry.hpp>
+#include <NGIN/Reflection/BinarySerializer.hpp>
+#include <NGIN/Reflection/Equality.hpp>
+
+#include <expected>
+#include <string>
+#include <utility>
+
+namespace NGIN::Reflection::detail
+{
+  // Where a plan step finds its member: at a fixed offset inside the owner, or through the
+  // field's getters when the owner has no recorded offsets.
+  struct MemberAccess
+  {
+    NGIN::UIntSize offset{0};
+    const void *(*getConst)(const void *){nullptr};
+    void *(*getMut)(void *){nullptr};
+
+    [[nodiscard]] static MemberAccess Of(const FieldDescriptor &f) noexcept
+    {
+      if (f.offset != kNoFieldOffset)
+        return MemberAccess{f.offset};
+      return MemberAccess{0, f.GetConst, f.GetMut};
+    }
+
+    [[nodiscard]] bool Direct() const noexcept { return !getConst; }
+
+    // True when `size` bytes here end where `next` starts, so the two can share one byte run.
+    [[nodiscard]] bool Abuts(NGIN::UIntSize size, const MemberAccess &next) const noexcept
+    {
+      return Direct() && next.Direct() && offset + size == next.offset;
+    }
+
+    [[nodiscard]] const unsigned char *In(const void *owner) const noexcept
+    {
+      if (getConst)
+        return static_cast<const unsigned char *>(getConst(owner));
+      return static_cast<const unsigned char *>(owner) + offset;
+    }
+
+    [[nodiscard]] unsigned char *In(void *owner) const noexcept
+    {
+      if (getMut)
+        return static_cast<unsigned char *>(getMut(owner));
+      return static_cast<unsigned char *>(owner) + offset;
+    }
+  };
+
+  // Binary codec and deep equality thunks of a field. Registration generates them only with
+  // NGIN_REFLECTION_ENABLE_FIELD_CODECS; std::string members are recognized by type id and get
+  // the library's own either way.
+  struct FieldCodecs
+  {
+    decltype(FieldDescriptor::WriteBinary) writeBinary{nullptr};
+    decltype(FieldDescriptor::ReadBinary) readBinary{nullptr};
+    decltype(FieldDescriptor::DeepEqual) deepEqual{nullptr};
+    decltype(FieldDescriptor::DeepHash) deepHash{nullptr};
+
+    [[nodiscard]] static FieldCodecs Of(const FieldDescriptor &f) noexcept
+    {
+      if (f.typeId == TypeIdOf<std::string>())
+        return FieldCodecs{&EncodeBinaryThunk<std::string>, &DecodeBinaryThunk<std::string>, &DeepEqualThunk<std::string>,
+                           &DeepHashThunk<std::string>};
+      return FieldCodecs{f.WriteBinary, f.ReadBinary, f.DeepEqual, f.DeepHash};
+    }
+  };
+
+  // Plans compiled once per registered type id and referred to by index. Compile reserves a
+  // type's slot before compiling its members, so recursive types resolve and indices stay
+  // valid while the table grows.
+  //
+  // Running a plan can re-enter the cache (codecs compile element plans mid-run), so the
+  // table is never reset under a running plan: only the outermost Scope compares
+  // RegistryEpoch() and drops stale plans, and a failed compile removes only the slots it
+  // reserved itself.
+  template <class Plan>
+  class PlanCache
+  {
+  public:
+    // Held by every entry point for the duration of a run.
+    class Scope
+    {
+    public:
+      explicit Scope(PlanCache &cache) noexcept : m_cache(cache)
+      {
+        if (m_cache.m_depth++ == 0)
+          m_cache.Revalidate();
+      }
+      ~Scope() { --m_cache.m_depth; }
+      Scope(const Scope &) = delete;
+      Scope &operator=(const Scope &) = delete;
+
+    private:
+      PlanCache &m_cache;
+    };
+
+    [[nodiscard]] Scope Enter() noexcept { return Scope{*this}; }
+
+    [[nodiscard]] NGIN::UIntSize Size() const noexcept { return m_plans.Size(); }
+    [[nodiscard]] const NGIN::UInt32 *Find(NGIN::UInt64 typeId) const noexcept { return m_byTypeId.GetPtr(typeId); }
+    [[nodiscard]] Plan &operator[](NGIN::UInt32 index) noexcept { return m_plans[index]; }
+    [[nodiscard]] const Plan &operator[](NGIN::UInt32 index) const noexcept { return m_plans[index]; }
+
+    // Index of typeId's plan, compiled by `build(desc, plan)` if the table has none yet. The
+    // slot is reserved before `build` runs, so nested and recursive members compiled from it
+    // can refer to the plan by index. Caller holds the registry read lock.
+    template <class BuildFn>
+    std::expected<NGIN::UInt32, Error> Compile(const Registry &reg, NGIN::UInt64 typeId, BuildFn &&build)
+    {
+      if (const auto *p = m_byTypeId.GetPtr(typeId))
+        return *p;
+      const auto *typeIndex = reg.byTypeId.GetPtr(typeId);
+      if (!typeIndex)
+        return std::unexpected(Error{ErrorCode::NotFound, "type is not reflected"});
+      const auto index = Reserve(typeId);
+      Plan plan{};
+      if (auto r = build(reg.types[*typeIndex], plan); !r.has_value())
+        return std::unexpected(std::move(r.error()));
+      m_plans[index] = std::move(plan);
+      return index;
+    }
+
+    // Index of typeId's plan. On a miss `compile()` runs (it returns the index or an Error);
+    // when it fails, the partially compiled plans it reserved are dropped again.
+    template <class CompileFn>
+    std::expected<NGIN::UInt32, Error> Get(NGIN::UInt64 typeId, CompileFn &&compile)
+    {
+      if (const auto *p = m_byTypeId.GetPtr(typeId))
+        return *p;
+      const auto mark = m_plans.Size();
+      auto compiled = std::forward<CompileFn>(compile)();
+      if (!compiled.has_value())
+        Truncate(mark);
+      return compiled;
+    }
+
+    // Not to be called while a plan runs; entry points use Scope instead.
+    void Clear() noexcept
+    {
+      m_plans.Clear();
+      m_typeIds.Clear();
+      m_byTypeId.Clear();
+    }
+
+  private:
+    NGIN::UInt32 Reserve(NGIN::UInt64 typeId)
+    {
+      const auto index = static_cast<NGIN::UInt32>(m_plans.Size());
+      m_plans.PushBack(Plan{});
+      m_typeIds.PushBack(typeId);
+      m_byTypeId.Insert(typeId, index);
+      return index;
+    }
+
+    void Revalidate() noexcept
+    {
+      const auto epoch = RegistryEpoch();
+      if (epoch != m_epoch)
+      {
+        Clear();
+        m_epoch = epoch;
+      }
+    }
+
+    void Truncate(NGIN::UIntSize size) noexcept
+    {
+      while (m_plans.Size() > size)
+      {
+        m_byTypeId.Remove(m_typeIds[m_typeIds.Size() - 1]);
+        m_typeIds.PopBack();
+        m_plans.PopBack();
+      }
+    }
+
+    NGIN::Containers::Vector<Plan> m_plans;
+    NGIN::Containers::Vector<NGIN::UInt64> m_typeIds;
+    NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UInt32> m_byTypeId;
+    NGIN::UInt64 m_epoch{0};
+    NGIN::UInt32 m_depth{0};
+  };
+} // namespace NGIN::Reflection::detail
@@ -7,6 +7,15 @@
 #include <NGIN/Reflection/Registry.hpp>
 #include <NGIN/Reflection/NameUtils.hpp>
 #include <NGIN/Reflection/TypeBuilder.hpp>
+#include <NGIN/Reflection/CallSite.hpp>
+#include <NGIN/Reflection/ObjectPool.hpp>
+#include <NGIN/Reflection/AnyArena.hpp>
+#include <NGIN/Reflection/BinarySerializer.hpp>
+#include <NGIN/Reflection/JsonSerializer.hpp>
+#include <NGIN/Reflection/FieldDelta.hpp>
+#include <NGIN/Reflection/Equality.hpp>
+#include <NGIN/Reflection/FieldPath.hpp>
+#include <NGIN/Reflection/Mapper.hpp>
 #include <NGIN/Reflection/ModuleInit.hpp>
 #include <NGIN/Meta/TypeName.hpp>
 
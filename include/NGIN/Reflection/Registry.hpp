@@ -20,6 +20,8 @@
 #include <string>
 #include <optional>
 #include <memory>
+#include <new>
+#include <cstring>
 #include <utility>
 
 #include <NGIN/Reflection/Types.hpp>
@@ -62,7 +64,19 @@ namespace NGIN::Reflection
   class Base;
   class Function;
   class ResolvedFunction;
+  class ResolvedConstructor;
   class AttributeView;
+  class CallSite;
+  class ObjectPool;
+  class BinarySerializer;
+  class BinaryWriter;
+  class BinaryReader;
+  class JsonSerializer;
+  class JsonWriter;
+  class JsonReader;
+  struct FieldPatch;
+  class FieldPath;
+  class Mapper;
 
   namespace detail
   {
@@ -89,7 +103,7 @@ namespace NGIN::Reflection
     std::string_view NameFromId(NameId id) noexcept;
     // Compute FNV-based type id for a type
     template <class T>
-    inline NGIN::UInt64 TypeIdOf()
+    constexpr NGIN::UInt64 TypeIdOf()
     {
       auto sv = NGIN::Meta::TypeName<std::remove_cv_t<std::remove_reference_t<T>>>::qualifiedName;
       return NGIN::Hashing::FNV1a64(sv.data(), sv.size());
@@ -101,16 +115,49 @@ namespace NGIN::Reflection
 
     AttrValue InternAttrValue(ModuleId moduleId, const AttrValue &value) noexcept;
 
+    inline constexpr NGIN::UIntSize kNoFieldOffset = static_cast<NGIN::UIntSize>(-1);
+    inline constexpr std::string_view kStaleHandle = "stale handle";
+
+    // Values whose bytes are their identity. Floating point counts too: compared and hashed
+    // bitwise, so -0.0 != 0.0 and a NaN equals the same NaN.
+    template <class T>
+    inline constexpr bool IsBytewise = std::is_scalar_v<T> || std::has_unique_object_representations_v<T>;
+
     struct FieldDescriptor
     {
       std::string_view name;
       NameId nameId{};
       NGIN::UInt64 typeId;
       NGIN::UIntSize sizeBytes{0};
+      // Byte offset inside the owner; recorded only for standard-layout owners.
+      NGIN::UIntSize offset{kNoFieldOffset};
       void *(*GetMut)(void *){nullptr};
       const void *(*GetConst)(const void *){nullptr};
       Any (*Load)(const void *){nullptr};
       std::expected<void, Error> (*Store)(void *, const Any &){nullptr};
+      ConstAnyView (*GetView)(const void *){nullptr};
+      AnyView (*GetMutView)(void *){nullptr};
+      // Binary codec for strings/containers; trivially copyable members are memcpy'd instead.
+      // The codec and deep equality thunks below are generated only in builds with
+      // NGIN_REFLECTION_ENABLE_FIELD_CODECS (the default). Without them the plan engines still
+      // handle std::string members, but containers are not serializable, diffable or comparable.
+      bool triviallyCopyable{false};
+      std::expected<void, Error> (*WriteBinary)(const void *member, BinarySerializer &, BinaryWriter &){nullptr};
+      std::expected<void, Error> (*ReadBinary)(void *member, BinarySerializer &, BinaryReader &){nullptr};
+      // JSON codec for sequence/map members; scalars and strings are handled by the plan, enums
+      // and classes use their own plan.
+      std::expected<void, Error> (*WriteJson)(const void *member, JsonSerializer &, JsonWriter &){nullptr};
+      std::expected<void, Error> (*ReadJson)(void *member, JsonSerializer &, JsonReader &){nullptr};
+      // Deep equality/hash for strings and containers; other members are compared as bytes
+      // (when `bytewise`) or through their own type's plan.
+      bool bytewise{false};
+      std::expected<bool, Error> (*DeepEqual)(const void *a, const void *b){nullptr};
+      std::expected<NGIN::UInt64, Error> (*DeepHash)(const void *member, NGIN::UInt64 seed){nullptr};
+      // Strided copies of the field between `count` owners and a packed array of the field type.
+      void (*Gather)(const void *base, NGIN::UIntSize stride, NGIN::UIntSize count, void *out){nullptr};
+      void (*Scatter)(void *base, NGIN::UIntSize stride, NGIN::UIntSize count, const void *in){nullptr};
+      // Member copy assignment; set for copy-assignable members that are not trivially copyable.
+      void (*CopyAssign)(void *dst, const void *src){nullptr};
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
     };
 
@@ -121,17 +168,87 @@ namespace NGIN::Reflection
       NGIN::UInt64 typeId;
       Any (*Get)(const void *){nullptr};
       std::expected<void, Error> (*Set)(void *, const Any &){nullptr};
+      // Set only when the getter returns an lvalue reference (GetMutView: non-const T& only).
+      ConstAnyView (*GetView)(const void *){nullptr};
+      AnyView (*GetMutView)(void *){nullptr};
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
     };
 
+    // Order-dependent hash of a list of parameter (or argument) type ids.
+    constexpr NGIN::UInt64 SignatureHashStep(NGIN::UInt64 h, NGIN::UInt64 id) noexcept
+    {
+      h ^= id + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+      return h;
+    }
+    constexpr NGIN::UInt64 ParamSignatureHash(const NGIN::UInt64 *ids, NGIN::UIntSize count) noexcept
+    {
+      NGIN::UInt64 h = 1469598103934665603ull ^ count;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+        h = SignatureHashStep(h, ids[i]);
+      return h;
+    }
+    // Full signature: the parameter list hash folded with the return type id (0 for void).
+    constexpr NGIN::UInt64 SignatureHash(NGIN::UInt64 returnTypeId, const NGIN::UInt64 *ids, NGIN::UIntSize count) noexcept
+    {
+      return SignatureHashStep(ParamSignatureHash(ids, count), returnTypeId);
+    }
+    inline NGIN::UInt64 SignatureHash(NGIN::UInt64 returnTypeId, const NGIN::Containers::Vector<NGIN::UInt64> &paramTypeIds) noexcept
+    {
+      const auto count = paramTypeIds.Size();
+      return SignatureHash(returnTypeId, count ? &paramTypeIds[0] : nullptr, count);
+    }
+    // SignatureHash of the C++ signature R(A...), evaluated at compile time.
+    template <class R, class... A>
+    constexpr NGIN::UInt64 TypedSignatureHash() noexcept
+    {
+      constexpr NGIN::UInt64 ids[sizeof...(A) + 1] = {TypeIdOf<A>()..., 0};
+      if constexpr (std::is_void_v<R>)
+        return SignatureHash(0, ids, sizeof...(A));
+      else
+        return SignatureHash(TypeIdOf<R>(), ids, sizeof...(A));
+    }
+
+    // Overloads of one name grouped by arity (byArity[n] lists the n-parameter overloads in
+    // registration order), plus the first overload registered for each exact parameter list
+    // and for each full signature.
+    struct OverloadDispatch
+    {
+      NGIN::Containers::Vector<NGIN::Containers::Vector<NGIN::UInt32>> byArity;
+      NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UInt32> exact;
+      NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UInt32> bySignature;
+    };
+    void AddOverload(OverloadDispatch &dispatch, NGIN::UInt32 index, const NGIN::Containers::Vector<NGIN::UInt64> &paramTypeIds,
+                     NGIN::UInt64 signatureHash);
+
+    // Constructs a parameter value in the uninitialized storage at `dst` from the argument
+    // object at `src`. Picked once per argument when a call is resolved (see ArgPlan).
+    using ArgConverter = void (*)(const void *src, void *dst);
+
+    // One edge of the user-defined conversion graph (TypeBuilder::ConvertsTo).
+    struct ConversionEdge
+    {
+      NGIN::UInt64 from{0};
+      NGIN::UInt64 to{0};
+      ArgConverter convert{nullptr};
+      int cost{1};
+      ModuleId moduleId{0};
+    };
+
     struct MethodDescriptor
     {
       std::string_view name;
       NameId nameId{};
       NGIN::UInt64 returnTypeId;
       NGIN::Containers::Vector<NGIN::UInt64> paramTypeIds;
+      NGIN::UInt64 signatureHash{0}; // SignatureHash(returnTypeId, paramTypeIds)
       std::expected<Any, Error> (*Invoke)(void *, const Any *, NGIN::UIntSize){nullptr};
       std::expected<Any, Error> (*InvokeExact)(void *, const Any *, NGIN::UIntSize){nullptr};
+      // Binds argument i through converters[i], or exactly when converters[i] is null.
+      std::expected<Any, Error> (*InvokeConverted)(void *, const Any *, NGIN::UIntSize, const ArgConverter *){nullptr};
+      // Set only when the method returns an lvalue reference (InvokeMutView: non-const T& only).
+      std::expected<ConstAnyView, Error> (*InvokeView)(void *, const Any *, NGIN::UIntSize){nullptr};
+      std::expected<AnyView, Error> (*InvokeMutView)(void *, const Any *, NGIN::UIntSize){nullptr};
+      NGIN::UInt64 outParamMask{0}; // bit i set when parameter i is a non-const T&
       bool isConst{false};
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
     };
@@ -142,13 +259,30 @@ namespace NGIN::Reflection
       NameId nameId{};
       NGIN::UInt64 returnTypeId;
       NGIN::Containers::Vector<NGIN::UInt64> paramTypeIds;
+      NGIN::UInt64 signatureHash{0};
       std::expected<Any, Error> (*Invoke)(const Any *, NGIN::UIntSize){nullptr};
       std::expected<Any, Error> (*InvokeExact)(const Any *, NGIN::UIntSize){nullptr};
+      std::expected<Any, Error> (*InvokeConverted)(const Any *, NGIN::UIntSize, const ArgConverter *){nullptr};
+      NGIN::UInt64 outParamMask{0};
       ModuleId moduleId{0};
       bool alive{true};
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
     };
 
+    // Exact comparison backing a signature-hash hit (method or function descriptor).
+    template <class Desc>
+    inline bool MatchesSignature(const Desc &d, NGIN::UInt64 returnTypeId, const NGIN::UInt64 *ids, NGIN::UIntSize count) noexcept
+    {
+      if (d.returnTypeId != returnTypeId || d.paramTypeIds.Size() != count)
+        return false;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        if (d.paramTypeIds[i] != ids[i])
+          return false;
+      }
+      return true;
+    }
+
     struct EnumValueDescriptor
     {
       std::string_view name;
@@ -183,6 +317,14 @@ namespace NGIN::Reflection
     {
       NGIN::Containers::Vector<NGIN::UInt64> paramTypeIds;
       std::expected<Any, Error> (*Construct)(const Any *, NGIN::UIntSize){nullptr};
+      std::expected<Any, Error> (*ConstructExact)(const Any *, NGIN::UIntSize){nullptr};
+      std::expected<Any, Error> (*ConstructConverted)(const Any *, NGIN::UIntSize, const ArgConverter *){nullptr};
+      // Constructs into caller storage (sizeBytes/alignBytes of the type). With null
+      // converters arguments bind as in Construct; otherwise as in ConstructConverted.
+      std::expected<void, Error> (*ConstructAt)(void *, const Any *, NGIN::UIntSize, const ArgConverter *){nullptr};
+      // Constructs `n` adjacent objects into caller storage, binding the arguments once.
+      std::expected<void, Error> (*ConstructArray)(void *, NGIN::UIntSize n, const Any *, NGIN::UIntSize, const ArgConverter *){nullptr};
+      NGIN::UInt64 outParamMask{0};
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
     };
 
@@ -195,6 +337,11 @@ namespace NGIN::Reflection
       NGIN::UInt32 generation{0};
       NGIN::UIntSize sizeBytes;
       NGIN::UIntSize alignBytes;
+      // Object lifecycle on caller storage; null when T lacks the operation (and for ABI types).
+      void (*Destroy)(void *){nullptr};
+      void (*MoveConstruct)(void *dst, void *src){nullptr};
+      void (*CopyConstruct)(void *dst, const void *src){nullptr};
+      void (*DestroyArray)(void *, NGIN::UIntSize n){nullptr};
       NGIN::Containers::Vector<FieldDescriptor> fields;
       NGIN::Containers::FlatHashMap<NameId, NGIN::UInt32> fieldIndex;
       NGIN::Containers::Vector<PropertyDescriptor> properties;
@@ -206,6 +353,7 @@ namespace NGIN::Reflection
       NGIN::Containers::Vector<ConstructorDescriptor> constructors;
       NGIN::Containers::Vector<NGIN::Reflection::AttributeDesc> attributes;
       NGIN::Containers::FlatHashMap<NameId, NGIN::Containers::Vector<NGIN::UInt32>> methodOverloads;
+      NGIN::Containers::FlatHashMap<NameId, OverloadDispatch> methodDispatch;
     };
 
     struct Registry
@@ -215,6 +363,10 @@ namespace NGIN::Reflection
       NGIN::Containers::FlatHashMap<NameId, NGIN::UInt32> byName;
       NGIN::Containers::Vector<FunctionDescriptor> functions;
       NGIN::Containers::FlatHashMap<NameId, NGIN::Containers::Vector<NGIN::UInt32>> functionOverloads;
+      NGIN::Containers::FlatHashMap<NameId, OverloadDispatch> functionDispatch;
+      NGIN::Containers::Vector<ConversionEdge> conversions;
+      // Number of conversion edges leaving each source type id; absent = none.
+      NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UInt32> conversionSources;
       NGIN::Containers::Vector<ModuleStrings> modules;
       NGIN::Containers::FlatHashMap<ModuleId, NGIN::UInt32> moduleIndex;
       mutable std::shared_mutex mutex;
@@ -260,6 +412,27 @@ namespace NGIN::Reflection
     bool IsBaseAlive(const Registry &reg, BaseHandle h) noexcept;
     bool IsMethodAlive(const Registry &reg, NGIN::UInt32 typeIndex, NGIN::UInt32 typeGeneration, NGIN::UInt32 methodIndex) noexcept;
     bool IsFunctionAlive(const Registry &reg, FunctionHandle h) noexcept;
+
+    // Monotonic counter bumped whenever registered metadata changes in a way that can
+    // change overload resolution or a cached per-type plan: new functions, conversions,
+    // fields, methods or constructors (also when a TypeBuilder is used after registration),
+    // module unload, ABI merge.
+    NGIN::UInt64 RegistryEpoch() noexcept;
+    void BumpRegistryEpoch() noexcept;
+
+    // Process-wide memo of overload resolution results, keyed by (kind, type handle, name,
+    // argument type ids). Entries are tagged with RegistryEpoch() and ignored once it moves
+    // on. Both calls must be made with the registry lock held.
+    enum class ResolveKind : NGIN::UInt8
+    {
+      Method,
+      Function,
+      Constructor
+    };
+    bool FindCachedOverload(ResolveKind kind, TypeHandle owner, std::string_view name,
+                            const Any *args, NGIN::UIntSize count, NGIN::UInt32 &outIndex) noexcept;
+    void StoreCachedOverload(ResolveKind kind, TypeHandle owner, std::string_view name,
+                             const Any *args, NGIN::UIntSize count, NGIN::UInt32 index) noexcept;
     void IncrementModuleTypeCount(ModuleId moduleId) noexcept;
     void DecrementModuleTypeCount(ModuleId moduleId) noexcept;
 
@@ -332,19 +505,113 @@ namespace NGIN::Reflection
     template <class T>
     inline constexpr bool IsFunctionPtrV = IsFunctionPtr<T>::value;
 
-    template <class T>
-    inline bool ArgMatchesExact(const Any &arg)
+    // Non-const lvalue reference parameters are out-params: they only bind to an AnyView.
+    template <class P>
+    inline constexpr bool IsOutParamV = std::is_lvalue_reference_v<P> && !std::is_const_v<std::remove_reference_t<P>>;
+
+    // Type id an argument presents to overload resolution. Arguments holding an
+    // AnyView/ConstAnyView are resolved by the type of the referenced object.
+    inline NGIN::UInt64 ArgTypeId(const Any &arg)
     {
-      using U = std::remove_cv_t<std::remove_reference_t<T>>;
-      return arg.GetTypeId() == TypeIdOf<U>();
+      constexpr auto viewId = TypeIdOf<AnyView>();
+      constexpr auto constViewId = TypeIdOf<ConstAnyView>();
+      const auto tid = arg.GetTypeId();
+      if (tid == viewId)
+        return arg.template Cast<AnyView>().TypeId();
+      if (tid == constViewId)
+        return arg.template Cast<ConstAnyView>().TypeId();
+      return tid;
+    }
+
+    inline bool ArgIsMutableView(const Any &arg)
+    {
+      constexpr auto viewId = TypeIdOf<AnyView>();
+      return arg.GetTypeId() == viewId;
+    }
+
+    // ParamSignatureHash of the argument type ids of a call.
+    inline NGIN::UInt64 ArgSignatureHash(const Any *args, NGIN::UIntSize count)
+    {
+      NGIN::UInt64 h = 1469598103934665603ull ^ count;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+        h = SignatureHashStep(h, ArgTypeId(args[i]));
+      return h;
+    }
+
+    // Address of the argument object, looking through views.
+    inline const void *ArgData(const Any &arg)
+    {
+      constexpr auto viewId = TypeIdOf<AnyView>();
+      constexpr auto constViewId = TypeIdOf<ConstAnyView>();
+      const auto tid = arg.GetTypeId();
+      if (tid == viewId)
+        return arg.template Cast<AnyView>().Data();
+      if (tid == constViewId)
+        return arg.template Cast<ConstAnyView>().Data();
+      return arg.Data();
     }
 
-    enum class ConversionKind : NGIN::UInt8
+    // Converter between two type ids: an arithmetic conversion, else the cheapest registered
+    // user-defined conversion, else nullptr. Registry lock must be held.
+    ArgConverter FindArgConverter(NGIN::UInt64 from, NGIN::UInt64 to) noexcept;
+    // As FindArgConverter, but only arithmetic conversions that represent every source value
+    // exactly (e.g. short -> int, float -> double, int -> double); narrowing pairs go to the
+    // user-defined conversions, so registering one opts a pair in. Registry lock must be held.
+    ArgConverter FindValuePreservingConverter(NGIN::UInt64 from, NGIN::UInt64 to) noexcept;
+
+    // User-defined conversion graph. Each (from, to) pair is searched once and the cheapest
+    // edge (cost, then registration order) is memoized, misses included. Registration and
+    // removal need the registry write lock and flush the memo; lookups need the read lock.
+    void RegisterConversion(const ConversionEdge &edge);
+    void RemoveModuleConversions(ModuleId moduleId);
+    ArgConverter FindUserConversion(NGIN::UInt64 from, NGIN::UInt64 to, int &outCost) noexcept;
+
+    inline constexpr NGIN::UIntSize kInlineArgCapacity = 8;
+
+    // Argument plan of a resolved call: the argument type ids it was resolved for and the
+    // converter chosen for each argument (nullptr = binds exactly). Calls with up to
+    // kInlineArgCapacity arguments are stored inline and never allocate.
+    class ArgPlan
     {
-      Exact = 0,
-      Convert = 1,
+    public:
+      void Build(const NGIN::Containers::Vector<NGIN::UInt64> &paramTypeIds, const Any *args, NGIN::UIntSize count);
+      // Plan for arguments already known to match `ids` exactly (typed resolution).
+      void BuildExact(const NGIN::UInt64 *ids, NGIN::UIntSize count);
+
+      [[nodiscard]] NGIN::UIntSize Size() const noexcept { return m_count; }
+      [[nodiscard]] const NGIN::UInt64 *TypeIds() const noexcept
+      {
+        return m_count <= kInlineArgCapacity ? m_inlineIds.data() : m_heapIds.data();
+      }
+      [[nodiscard]] const ArgConverter *Converters() const noexcept
+      {
+        return m_count <= kInlineArgCapacity ? m_inlineConverters.data() : m_heapConverters.data();
+      }
+      // True when at least one argument is converted rather than bound exactly.
+      [[nodiscard]] bool NeedsConversion() const noexcept { return m_needsConversion; }
+      // False when a converted argument has no direct converter and needs the generic thunk.
+      [[nodiscard]] bool HasAllConverters() const noexcept { return m_hasAllConverters; }
+
+    private:
+      std::array<NGIN::UInt64, kInlineArgCapacity> m_inlineIds{};
+      std::array<ArgConverter, kInlineArgCapacity> m_inlineConverters{};
+      NGIN::Containers::Vector<NGIN::UInt64> m_heapIds;
+      NGIN::Containers::Vector<ArgConverter> m_heapConverters;
+      NGIN::UInt32 m_count{0};
+      bool m_needsConversion{false};
+      bool m_hasAllConverters{true};
     };
 
+    template <class T>
+    inline bool ArgMatchesExact(const Any &arg)
+    {
+      using U = std::remove_cv_t<std::remove_reference_t<T>>;
+      if constexpr (IsOutParamV<T>)
+        return ArgIsMutableView(arg) && ArgTypeId(arg) == TypeIdOf<U>();
+      else
+        return ArgTypeId(arg) == TypeIdOf<U>();
+    }
+
     // Function pointers for field accessors
     template <auto MemberPtr>
     static void *FieldGetterMut(void *obj)
@@ -371,6 +638,79 @@ namespace NGIN::Reflection
       return Any{static_cast<const M &>(c->*MemberPtr)};
     }
 
+    template <auto MemberPtr>
+    static ConstAnyView FieldGetView(const void *obj)
+    {
+      using C = MemberClassT<MemberPtr>;
+      return Any::FromConstRef(static_cast<const C *>(obj)->*MemberPtr);
+    }
+
+    template <auto MemberPtr>
+    static AnyView FieldGetMutView(void *obj)
+    {
+      using C = MemberClassT<MemberPtr>;
+      return Any::FromRef(static_cast<C *>(obj)->*MemberPtr);
+    }
+
+    template <auto MemberPtr>
+    NGIN::UIntSize FieldOffset()
+    {
+      using C = MemberClassT<MemberPtr>;
+      if constexpr (std::is_standard_layout_v<C>)
+      {
+        alignas(C) unsigned char storage[sizeof(C)]{};
+        const auto *c = reinterpret_cast<const C *>(storage);
+        return static_cast<NGIN::UIntSize>(reinterpret_cast<const unsigned char *>(&(c->*MemberPtr)) - storage);
+      }
+      else
+      {
+        return kNoFieldOffset;
+      }
+    }
+
+    // The member pointer folds to a constant offset, so these loops have no per-object call and
+    // vectorize for trivially copyable fields.
+    template <auto MemberPtr>
+    static void FieldGather(const void *base, NGIN::UIntSize stride, NGIN::UIntSize count, void *out)
+    {
+      using C = MemberClassT<MemberPtr>;
+      using M = MemberTypeT<MemberPtr>;
+      const auto *src = static_cast<const unsigned char *>(base);
+      auto *dst = static_cast<M *>(out);
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        const auto &value = reinterpret_cast<const C *>(src + i * stride)->*MemberPtr;
+        if constexpr (std::is_trivially_copyable_v<M>)
+          std::memcpy(static_cast<void *>(dst + i), &value, sizeof(M));
+        else
+          dst[i] = value;
+      }
+    }
+
+    template <auto MemberPtr>
+    static void FieldScatter(void *base, NGIN::UIntSize stride, NGIN::UIntSize count, const void *in)
+    {
+      using C = MemberClassT<MemberPtr>;
+      using M = MemberTypeT<MemberPtr>;
+      auto *dst = static_cast<unsigned char *>(base);
+      const auto *src = static_cast<const M *>(in);
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        auto &value = reinterpret_cast<C *>(dst + i * stride)->*MemberPtr;
+        if constexpr (std::is_trivially_copyable_v<M>)
+          std::memcpy(static_cast<void *>(&value), src + i, sizeof(M));
+        else
+          value = src[i];
+      }
+    }
+
+    // Member-to-member copy for fields that are copy-assignable but not trivially copyable.
+    template <class T>
+    void CopyAssignThunk(void *dst, const void *src)
+    {
+      *static_cast<T *>(dst) = *static_cast<const T *>(src);
+    }
+
     template <auto MemberPtr>
     static std::expected<void, Error> FieldStore(void *obj, const Any &value)
     {
@@ -385,6 +725,31 @@ namespace NGIN::Reflection
       return {};
     }
 
+    template <class T>
+    void DestroyThunk(void *obj)
+    {
+      static_cast<T *>(obj)->~T();
+    }
+
+    template <class T>
+    void DestroyArrayThunk(void *obj, NGIN::UIntSize n)
+    {
+      if constexpr (!std::is_trivially_destructible_v<T>)
+        std::destroy_n(static_cast<T *>(obj), n);
+    }
+
+    template <class T>
+    void MoveConstructThunk(void *dst, void *src)
+    {
+      ::new (dst) T(std::move(*static_cast<T *>(src)));
+    }
+
+    template <class T>
+    void CopyConstructThunk(void *dst, const void *src)
+    {
+      ::new (dst) T(*static_cast<const T *>(src));
+    }
+
     // Ensure a type is present; returns the type index. Caller must hold a write lock.
     template <class T>
     NGIN::UInt32 EnsureRegistered(ModuleId moduleId = ModuleId{0})
@@ -404,16 +769,46 @@ namespace NGIN::Reflection
       rec.moduleId = moduleId;
       rec.sizeBytes = sizeof(U);
       rec.alignBytes = alignof(U);
+      if constexpr (std::is_destructible_v<U>)
+      {
+        rec.Destroy = &DestroyThunk<U>;
+        rec.DestroyArray = &DestroyArrayThunk<U>;
+      }
+      if constexpr (std::is_move_constructible_v<U>)
+        rec.MoveConstruct = &MoveConstructThunk<U>;
+      if constexpr (std::is_copy_constructible_v<U>)
+        rec.CopyConstruct = &CopyConstructThunk<U>;
 
       // Default constructor descriptor (if available)
       if constexpr (std::is_default_constructible_v<U>)
       {
         ConstructorDescriptor c{};
-        c.Construct = [](const Any *, NGIN::UIntSize cnt) -> std::expected<Any, Error>
+        // Types that cannot be moved into an Any are still constructible in place.
+        if constexpr (std::is_move_constructible_v<U>)
+        {
+          c.Construct = [](const Any *, NGIN::UIntSize cnt) -> std::expected<Any, Error>
+          {
+            if (cnt != 0)
+              return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+            return Any{U{}};
+          };
+          c.ConstructExact = c.Construct;
+        }
+        c.ConstructAt = [](void *storage, const Any *, NGIN::UIntSize cnt, const ArgConverter *) -> std::expected<void, Error>
         {
           if (cnt != 0)
             return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
-          return Any{U{}};
+          ::new (storage) U{};
+          return {};
+        };
+        c.ConstructArray = [](void *storage, NGIN::UIntSize n, const Any *, NGIN::UIntSize cnt, const ArgConverter *) -> std::expected<void, Error>
+        {
+          if (cnt != 0)
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+          // Value-initializes every element; compilers lower this to a memset for types whose
+          // value is all-zero bits. Built elements are destroyed again if one throws.
+          std::uninitialized_value_construct_n(static_cast<U *>(storage), n);
+          return {};
         };
         rec.constructors.PushBack(std::move(c));
       }
@@ -460,6 +855,53 @@ namespace NGIN::Reflection
   } // namespace detail
 
   // Public wrappers
+
+  // Typed field access validated once by Field::Bind<T>(): calls take no lock and compare no
+  // type ids. Reads through the recorded offset when the owner is standard-layout, otherwise
+  // through the getter thunk. Like a raw pointer, it must not be used once the owner's module
+  // is unloaded.
+  template <class T>
+  class FieldAccessor
+  {
+  public:
+    constexpr FieldAccessor() = default;
+
+    [[nodiscard]] constexpr bool IsValid() const noexcept { return m_offset != detail::kNoFieldOffset || m_get != nullptr; }
+    [[nodiscard]] constexpr FieldHandle Handle() const noexcept { return m_h; }
+
+    [[nodiscard]] T &operator()(void *obj) const noexcept
+    {
+      if (m_offset != detail::kNoFieldOffset)
+        return *reinterpret_cast<T *>(static_cast<unsigned char *>(obj) + m_offset);
+      return *static_cast<T *>(m_get(obj));
+    }
+    [[nodiscard]] const T &operator()(const void *obj) const noexcept
+    {
+      return (*this)(const_cast<void *>(obj));
+    }
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] T &operator()(Obj &obj) const noexcept
+    {
+      return (*this)(static_cast<void *>(std::addressof(obj)));
+    }
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] const T &operator()(const Obj &obj) const noexcept
+    {
+      return (*this)(static_cast<const void *>(std::addressof(obj)));
+    }
+
+  private:
+    friend class Field;
+    constexpr FieldAccessor(FieldHandle h, NGIN::UIntSize offset, void *(*get)(void *)) noexcept
+        : m_h(h), m_offset(offset), m_get(get) {}
+
+    FieldHandle m_h{};
+    NGIN::UIntSize m_offset{detail::kNoFieldOffset};
+    void *(*m_get)(void *){nullptr};
+  };
+
   class Field
   {
   public:
@@ -479,6 +921,14 @@ namespace NGIN::Reflection
 
     [[nodiscard]] void *GetMut(void *obj) const;
     [[nodiscard]] const void *GetConst(const void *obj) const;
+    // Byte offset inside the owner, known for standard-layout owners only.
+    [[nodiscard]] std::optional<NGIN::UIntSize> Offset() const;
+
+    // Copy this field of `count` owners placed `stride` bytes apart into `out`, an array of
+    // `count` field values (constructed unless the field type is trivially copyable).
+    // Scatter writes them back. One registry lookup per call, none per object.
+    [[nodiscard]] std::expected<void, Error> Gather(const void *base, NGIN::UIntSize stride, NGIN::UIntSize count, void *out) const;
+    [[nodiscard]] std::expected<void, Error> Scatter(void *base, NGIN::UIntSize stride, NGIN::UIntSize count, const void *in) const;
 
     // Any helpers
     [[nodiscard]] Any GetAny(const void *obj) const;
@@ -491,6 +941,25 @@ namespace NGIN::Reflection
       return GetAny(static_cast<const void *>(&obj));
     }
 
+    // Views of the member itself, no copy; valid while the object lives. Adapters can start
+    // from them via Adapters::AdaptView.
+    [[nodiscard]] std::expected<ConstAnyView, Error> GetView(const void *obj) const;
+    [[nodiscard]] std::expected<AnyView, Error> GetMutView(void *obj) const;
+
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] std::expected<ConstAnyView, Error> GetView(const Obj &obj) const
+    {
+      return GetView(static_cast<const void *>(std::addressof(obj)));
+    }
+
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] std::expected<AnyView, Error> GetMutView(Obj &obj) const
+    {
+      return GetMutView(static_cast<void *>(std::addressof(obj)));
+    }
+
     template <class Obj>
       requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
     [[nodiscard]] std::expected<void, Error> SetAny(Obj &obj, const Any &value) const
@@ -533,6 +1002,23 @@ namespace NGIN::Reflection
       return {};
     }
 
+    // Validate liveness and the field type once; the accessor then skips both on every call.
+    template <class T>
+    [[nodiscard]] std::expected<FieldAccessor<std::remove_cvref_t<T>>, Error> Bind() const
+    {
+      using U = std::remove_cvref_t<T>;
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      const auto &reg = detail::GetRegistry();
+      if (!detail::IsFieldAlive(reg, m_h))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
+      const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
+      if (f.typeId != detail::TypeIdOf<U>())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "type-id mismatch"});
+      if (f.offset == detail::kNoFieldOffset && !f.GetMut)
+        return std::unexpected(Error{ErrorCode::NotFound, "field has no accessor"});
+      return FieldAccessor<U>{m_h, f.offset, f.GetMut};
+    }
+
     // Attributes
     [[nodiscard]] NGIN::UIntSize AttributeCount() const;
     [[nodiscard]] AttributeView AttributeAt(NGIN::UIntSize i) const;
@@ -605,6 +1091,25 @@ namespace NGIN::Reflection
       return SetAny(obj, Any{std::forward<T>(value)});
     }
 
+    // Reference-returning getters can be viewed in place instead of copied into an Any.
+    [[nodiscard]] bool ReturnsReference() const;
+    [[nodiscard]] std::expected<ConstAnyView, Error> GetView(const void *obj) const;
+    [[nodiscard]] std::expected<AnyView, Error> GetMutView(void *obj) const;
+
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] std::expected<ConstAnyView, Error> GetView(const Obj &obj) const
+    {
+      return GetView(static_cast<const void *>(std::addressof(obj)));
+    }
+
+    template <class Obj>
+      requires(!std::is_pointer_v<std::remove_reference_t<Obj>>)
+    [[nodiscard]] std::expected<AnyView, Error> GetMutView(Obj &obj) const
+    {
+      return GetMutView(static_cast<void *>(std::addressof(obj)));
+    }
+
     // Attributes
     [[nodiscard]] NGIN::UIntSize AttributeCount() const;
     [[nodiscard]] AttributeView AttributeAt(NGIN::UIntSize i) const;
@@ -694,6 +1199,20 @@ namespace NGIN::Reflection
       const Any *p = args;
       return Invoke(obj, p, count);
     }
+
+    // Reference-returning methods can be invoked for a view of the referenced object (no copy).
+    [[nodiscard]] bool ReturnsReference() const;
+    [[nodiscard]] std::expected<ConstAnyView, Error> InvokeView(void *obj, const Any *args, NGIN::UIntSize count) const;
+    [[nodiscard]] std::expected<AnyView, Error> InvokeMutView(void *obj, const Any *args, NGIN::UIntSize count) const;
+    [[nodiscard]] std::expected<ConstAnyView, Error> InvokeView(void *obj, std::span<const Any> args) const
+    {
+      return InvokeView(obj, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+    [[nodiscard]] std::expected<AnyView, Error> InvokeMutView(void *obj, std::span<const Any> args) const
+    {
+      return InvokeMutView(obj, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+
     template <class R, class... A>
     [[nodiscard]] std::expected<R, Error> InvokeAs(void *obj, A &&...a) const
     {
@@ -794,16 +1313,14 @@ namespace NGIN::Reflection
   {
   public:
     ResolvedFunction() = default;
-    ResolvedFunction(NGIN::UInt32 functionIndex,
-                     NGIN::Containers::Vector<NGIN::UInt64> argTypeIds,
-                     NGIN::Containers::Vector<detail::ConversionKind> conversions)
-        : m_functionIndex(functionIndex), m_argTypeIds(std::move(argTypeIds)), m_conversions(std::move(conversions))
+    ResolvedFunction(NGIN::UInt32 functionIndex, detail::ArgPlan plan)
+        : m_functionIndex(functionIndex), m_plan(std::move(plan))
     {
     }
 
     [[nodiscard]] bool IsValid() const noexcept { return m_functionIndex != static_cast<NGIN::UInt32>(-1); }
     [[nodiscard]] Function FunctionHandle() const { return Function{NGIN::Reflection::FunctionHandle{m_functionIndex}}; }
-    [[nodiscard]] NGIN::UIntSize ArgumentCount() const { return m_argTypeIds.Size(); }
+    [[nodiscard]] NGIN::UIntSize ArgumentCount() const { return m_plan.Size(); }
 
     [[nodiscard]] std::expected<Any, Error> Invoke(std::span<const Any> args) const
     {
@@ -811,26 +1328,21 @@ namespace NGIN::Reflection
       const auto &reg = detail::GetRegistry();
       if (!detail::IsFunctionAlive(reg, NGIN::Reflection::FunctionHandle{m_functionIndex}))
         return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
-      if (args.size() != m_argTypeIds.Size())
+      if (args.size() != m_plan.Size())
         return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
-      for (NGIN::UIntSize i = 0; i < m_argTypeIds.Size(); ++i)
+      const auto *ids = m_plan.TypeIds();
+      for (NGIN::UIntSize i = 0; i < args.size(); ++i)
       {
-        if (args[i].GetTypeId() != m_argTypeIds[i])
+        if (detail::ArgTypeId(args[i]) != ids[i])
           return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
       }
       const auto &f = reg.functions[m_functionIndex];
-      bool needsConvert = false;
-      for (NGIN::UIntSize i = 0; i < m_conversions.Size(); ++i)
-      {
-        if (m_conversions[i] != detail::ConversionKind::Exact)
-        {
-          needsConvert = true;
-          break;
-        }
-      }
-      if (!needsConvert && f.InvokeExact)
-        return f.InvokeExact(args.data(), static_cast<NGIN::UIntSize>(args.size()));
-      return f.Invoke(args.data(), static_cast<NGIN::UIntSize>(args.size()));
+      const auto count = static_cast<NGIN::UIntSize>(args.size());
+      if (!m_plan.NeedsConversion() && f.InvokeExact)
+        return f.InvokeExact(args.data(), count);
+      if (m_plan.HasAllConverters() && f.InvokeConverted)
+        return f.InvokeConverted(args.data(), count, m_plan.Converters());
+      return f.Invoke(args.data(), count);
     }
 
     [[nodiscard]] std::expected<Any, Error> Invoke(const Any *args, NGIN::UIntSize count) const
@@ -852,8 +1364,7 @@ namespace NGIN::Reflection
 
   private:
     NGIN::UInt32 m_functionIndex{static_cast<NGIN::UInt32>(-1)};
-    NGIN::Containers::Vector<NGIN::UInt64> m_argTypeIds;
-    NGIN::Containers::Vector<detail::ConversionKind> m_conversions;
+    detail::ArgPlan m_plan{};
   };
 
   class ResolvedMethod
@@ -863,13 +1374,11 @@ namespace NGIN::Reflection
     ResolvedMethod(NGIN::UInt32 typeIndex,
                    NGIN::UInt32 typeGeneration,
                    NGIN::UInt32 methodIndex,
-                   NGIN::Containers::Vector<NGIN::UInt64> argTypeIds,
-                   NGIN::Containers::Vector<detail::ConversionKind> conversions)
+                   detail::ArgPlan plan)
         : m_typeIndex(typeIndex),
           m_typeGeneration(typeGeneration),
           m_methodIndex(methodIndex),
-          m_argTypeIds(std::move(argTypeIds)),
-          m_conversions(std::move(conversions))
+          m_plan(std::move(plan))
     {
     }
 
@@ -882,7 +1391,7 @@ namespace NGIN::Reflection
       return detail::IsMethodAlive(reg, m_typeIndex, m_typeGeneration, m_methodIndex);
     }
     [[nodiscard]] Method MethodHandle() const { return Method{m_typeIndex, m_methodIndex, m_typeGeneration}; }
-    [[nodiscard]] NGIN::UIntSize ArgumentCount() const { return m_argTypeIds.Size(); }
+    [[nodiscard]] NGIN::UIntSize ArgumentCount() const { return m_plan.Size(); }
 
     [[nodiscard]] std::expected<Any, Error> Invoke(void *obj, std::span<const Any> args) const
     {
@@ -890,26 +1399,21 @@ namespace NGIN::Reflection
       const auto &reg = detail::GetRegistry();
       if (!detail::IsMethodAlive(reg, m_typeIndex, m_typeGeneration, m_methodIndex))
         return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
-      if (args.size() != m_argTypeIds.Size())
+      if (args.size() != m_plan.Size())
         return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
-      for (NGIN::UIntSize i = 0; i < m_argTypeIds.Size(); ++i)
+      const auto *ids = m_plan.TypeIds();
+      for (NGIN::UIntSize i = 0; i < args.size(); ++i)
       {
-        if (args[i].GetTypeId() != m_argTypeIds[i])
+        if (detail::ArgTypeId(args[i]) != ids[i])
           return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
       }
       const auto &m = reg.types[m_typeIndex].methods[m_methodIndex];
-      bool needsConvert = false;
-      for (NGIN::UIntSize i = 0; i < m_conversions.Size(); ++i)
-      {
-        if (m_conversions[i] != detail::ConversionKind::Exact)
-        {
-          needsConvert = true;
-          break;
-        }
-      }
-      if (!needsConvert && m.InvokeExact)
-        return m.InvokeExact(obj, args.data(), static_cast<NGIN::UIntSize>(args.size()));
-      return m.Invoke(obj, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+      const auto count = static_cast<NGIN::UIntSize>(args.size());
+      if (!m_plan.NeedsConversion() && m.InvokeExact)
+        return m.InvokeExact(obj, args.data(), count);
+      if (m_plan.HasAllConverters() && m.InvokeConverted)
+        return m.InvokeConverted(obj, args.data(), count, m_plan.Converters());
+      return m.Invoke(obj, args.data(), count);
     }
 
     [[nodiscard]] std::expected<Any, Error> Invoke(void *obj, const Any *args, NGIN::UIntSize count) const
@@ -971,11 +1475,12 @@ namespace NGIN::Reflection
     }
 
   private:
+    friend class CallSite;
+
     NGIN::UInt32 m_typeIndex{static_cast<NGIN::UInt32>(-1)};
     NGIN::UInt32 m_typeGeneration{0};
     NGIN::UInt32 m_methodIndex{static_cast<NGIN::UInt32>(-1)};
-    NGIN::Containers::Vector<NGIN::UInt64> m_argTypeIds;
-    NGIN::Containers::Vector<detail::ConversionKind> m_conversions;
+    detail::ArgPlan m_plan{};
   };
 
   class Constructor
@@ -998,6 +1503,8 @@ namespace NGIN::Reflection
     {
       return Construct(args.data(), static_cast<NGIN::UIntSize>(args.size()));
     }
+    // Construct into `storage`, which must fit the type's Size() and Alignment().
+    [[nodiscard]] std::expected<void, Error> ConstructAt(void *storage, const Any *args, NGIN::UIntSize count) const;
 
     // Attributes
     [[nodiscard]] NGIN::UIntSize AttributeCount() const;
@@ -1008,6 +1515,94 @@ namespace NGIN::Reflection
     ConstructorHandle m_h{};
   };
 
+  // Constructor chosen for one argument shape; reuse it to construct without re-resolving.
+  class ResolvedConstructor
+  {
+  public:
+    ResolvedConstructor() = default;
+    ResolvedConstructor(NGIN::Reflection::ConstructorHandle h, detail::ArgPlan plan)
+        : m_h(h), m_plan(std::move(plan))
+    {
+    }
+
+    [[nodiscard]] bool IsValid() const noexcept
+    {
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      if (!m_h.IsValid())
+        return false;
+      return detail::IsCtorAlive(detail::GetRegistry(), m_h);
+    }
+    [[nodiscard]] Constructor GetConstructor() const { return Constructor{m_h}; }
+    [[nodiscard]] NGIN::UIntSize ArgumentCount() const { return m_plan.Size(); }
+
+    [[nodiscard]] std::expected<Any, Error> Construct(std::span<const Any> args) const
+    {
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      const auto &reg = detail::GetRegistry();
+      if (!detail::IsCtorAlive(reg, m_h))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
+      if (args.size() != m_plan.Size())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+      const auto *ids = m_plan.TypeIds();
+      for (NGIN::UIntSize i = 0; i < args.size(); ++i)
+      {
+        if (detail::ArgTypeId(args[i]) != ids[i])
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+      }
+      const auto &c = reg.types[m_h.typeIndex].constructors[m_h.ctorIndex];
+      if (!c.Construct)
+        return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+      const auto count = static_cast<NGIN::UIntSize>(args.size());
+      if (!m_plan.NeedsConversion() && c.ConstructExact)
+        return c.ConstructExact(args.data(), count);
+      if (m_plan.HasAllConverters() && c.ConstructConverted)
+        return c.ConstructConverted(args.data(), count, m_plan.Converters());
+      return c.Construct(args.data(), count);
+    }
+
+    [[nodiscard]] std::expected<Any, Error> Construct(const Any *args, NGIN::UIntSize count) const
+    {
+      return Construct(std::span<const Any>{args, count});
+    }
+
+    [[nodiscard]] std::expected<void, Error> ConstructAt(void *storage, std::span<const Any> args) const
+    {
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      const auto &reg = detail::GetRegistry();
+      if (!detail::IsCtorAlive(reg, m_h))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
+      if (args.size() != m_plan.Size())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+      const auto *ids = m_plan.TypeIds();
+      for (NGIN::UIntSize i = 0; i < args.size(); ++i)
+      {
+        if (detail::ArgTypeId(args[i]) != ids[i])
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+      }
+      const auto &c = reg.types[m_h.typeIndex].constructors[m_h.ctorIndex];
+      if (!c.ConstructAt)
+        return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+      const auto *converters = m_plan.NeedsConversion() && m_plan.HasAllConverters() ? m_plan.Converters() : nullptr;
+      return c.ConstructAt(storage, args.data(), static_cast<NGIN::UIntSize>(args.size()), converters);
+    }
+
+    [[nodiscard]] std::expected<void, Error> ConstructAt(void *storage, const Any *args, NGIN::UIntSize count) const
+    {
+      return ConstructAt(storage, std::span<const Any>{args, count});
+    }
+
+    template <class... A>
+    [[nodiscard]] std::expected<Any, Error> ConstructFrom(A &&...a) const
+    {
+      std::array<Any, sizeof...(A)> tmp{Any{std::forward<A>(a)}...};
+      return Construct(std::span<const Any>{tmp.data(), tmp.size()});
+    }
+
+  private:
+    NGIN::Reflection::ConstructorHandle m_h{};
+    detail::ArgPlan m_plan{};
+  };
+
   class AttributeView
   {
   public:
@@ -1146,6 +1741,8 @@ namespace NGIN::Reflection
       const auto &reg = detail::GetRegistry();
       return detail::IsTypeAlive(reg, m_h);
     }
+    // Raw handle (index + generation); identifies the type without touching the registry.
+    [[nodiscard]] constexpr TypeHandle Handle() const noexcept { return m_h; }
     [[nodiscard]] std::string_view QualifiedName() const;
     [[nodiscard]] NGIN::UInt64 GetTypeId() const;
     [[nodiscard]] NGIN::UIntSize Size() const;
@@ -1154,7 +1751,37 @@ namespace NGIN::Reflection
     [[nodiscard]] NGIN::UIntSize FieldCount() const;
     [[nodiscard]] Field FieldAt(NGIN::UIntSize i) const;
     [[nodiscard]] ExpectedField GetField(std::string_view name) const;
+    // Batch access under one lock and liveness check, walking the field table in order.
+    // ReadFields fills out[i] with field i and returns the field count; `out` must hold at
+    // least FieldCount() values. WriteFields takes exactly FieldCount() values and checks
+    // every type id before storing any of them.
+    [[nodiscard]] std::expected<NGIN::UIntSize, Error> ReadFields(const void *obj, std::span<Any> out) const;
+    [[nodiscard]] std::expected<void, Error> WriteFields(void *obj, std::span<const Any> values) const;
+    // Same for a chosen subset; every handle must belong to this type.
+    [[nodiscard]] std::expected<void, Error> ReadFields(const void *obj, std::span<const Field> fields, std::span<Any> out) const;
+    [[nodiscard]] std::expected<void, Error> WriteFields(void *obj, std::span<const Field> fields, std::span<const Any> values) const;
     [[nodiscard]] std::optional<Field> FindField(std::string_view name) const;
+    // Field-level delta from `from` to `to` (see FieldPatch). Trivially copyable runs are
+    // compared with one memcmp and only split per field when they differ; reflected members
+    // recurse. Per-type plans are cached per thread. Returns whether anything changed; `out`
+    // is cleared first so its buffers can be reused across calls.
+    [[nodiscard]] std::expected<bool, Error> Diff(const void *from, const void *to, FieldPatch &out) const;
+    [[nodiscard]] std::expected<FieldPatch, Error> Diff(const void *from, const void *to) const;
+    // Applies a patch produced by Diff on this type. A malformed patch is rejected, possibly
+    // after some fields were already written.
+    [[nodiscard]] std::expected<void, Error> ApplyPatch(void *obj, const FieldPatch &patch) const;
+    // Deep equality and hashing generated from the field table. Runs of adjacent bytewise
+    // fields are compared with one memcmp and hashed as one block, skipping padding between
+    // and after fields; strings and containers compare element-wise; reflected members recurse.
+    // Floating-point fields compare bitwise, so -0.0 != 0.0 and a NaN equals the same NaN.
+    // Equal objects hash equal. Hashes are stable for one build and platform, not across them.
+    // Equals(p, p) still compiles the plan, so a type it cannot compare fails either way.
+    [[nodiscard]] std::expected<bool, Error> Equals(const void *a, const void *b) const;
+    [[nodiscard]] std::expected<NGIN::UInt64, Error> Hash(const void *obj) const;
+    // Compiles a dotted member path such as "transform.position.x" into a FieldPath. Every
+    // segment but the last must name a field whose type is reflected. Resolution happens once
+    // here; the path itself does no lookups or locking.
+    [[nodiscard]] std::expected<FieldPath, Error> CompilePath(std::string_view path) const;
 
     [[nodiscard]] NGIN::UIntSize PropertyCount() const;
     [[nodiscard]] Property PropertyAt(NGIN::UIntSize i) const;
@@ -1175,10 +1802,12 @@ namespace NGIN::Reflection
     [[nodiscard]] std::expected<Method, Error> GetMethod(std::string_view name) const;
     [[nodiscard]] std::optional<Method> FindMethod(std::string_view name) const;
     [[nodiscard]] MethodOverloads FindMethods(std::string_view name) const;
-    [[nodiscard]] std::expected<ResolvedMethod, Error> ResolveMethod(std::string_view name, const Any *args, NGIN::UIntSize count) const;
-    [[nodiscard]] std::expected<ResolvedMethod, Error> ResolveMethod(std::string_view name, std::span<const Any> args) const
+    [[nodiscard]] std::expected<ResolvedMethod, Error> ResolveMethod(std::string_view name, const Any *args, NGIN::UIntSize count,
+                                                                     ResolveOptions options = {}) const;
+    [[nodiscard]] std::expected<ResolvedMethod, Error> ResolveMethod(std::string_view name, std::span<const Any> args,
+                                                                     ResolveOptions options = {}) const
     {
-      return ResolveMethod(name, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+      return ResolveMethod(name, args.data(), static_cast<NGIN::UIntSize>(args.size()), options);
     }
 
     // Resolve by compile-time signature (exact match on parameter and, if non-void, return type)
@@ -1206,32 +1835,17 @@ namespace NGIN::Reflection
         else
           return detail::TypeIdOf<std::remove_cv_t<std::remove_reference_t<R>>>();
       }();
+      // One lookup by signature hash; the scan only runs on a miss or a hash collision.
+      if (const auto *dispatch = tdesc.methodDispatch.GetPtr(nid))
+      {
+        const auto *mi = dispatch->bySignature.GetPtr(detail::TypedSignatureHash<R, A...>());
+        if (mi && detail::MatchesSignature(tdesc.methods[*mi], desiredRet, desired, N))
+          return Method{m_h.index, *mi, m_h.generation};
+      }
       for (NGIN::UIntSize k = 0; k < vec->Size(); ++k)
       {
         auto mi = (*vec)[k];
-        const auto &m = tdesc.methods[mi];
-        if constexpr (!std::is_void_v<R>)
-        {
-          if (m.returnTypeId != desiredRet)
-            continue;
-        }
-        else
-        {
-          if (m.returnTypeId != 0)
-            continue;
-        }
-        if (m.paramTypeIds.Size() != N)
-          continue;
-        bool all = true;
-        for (NGIN::UIntSize i = 0; i < N; ++i)
-        {
-          if (m.paramTypeIds[i] != desired[i])
-          {
-            all = false;
-            break;
-          }
-        }
-        if (all)
+        if (detail::MatchesSignature(tdesc.methods[mi], desiredRet, desired, N))
           return Method{m_h.index, mi, m_h.generation};
       }
       return std::unexpected(Error{ErrorCode::InvalidArgument, "no exact match"});
@@ -1314,6 +1928,66 @@ namespace NGIN::Reflection
       const Any *none = nullptr;
       return Construct(none, 0);
     }
+    // In-place lifecycle on caller storage of Size() bytes aligned to Alignment(); lets
+    // reflected objects live in arenas, pools and chunks without an intermediate Any.
+    [[nodiscard]] std::expected<void, Error> ConstructAt(void *storage, const Any *args, NGIN::UIntSize count) const;
+    [[nodiscard]] std::expected<void, Error> ConstructAt(void *storage, std::span<const Any> args) const
+    {
+      return ConstructAt(storage, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+    [[nodiscard]] std::expected<void, Error> Destroy(void *obj) const;
+    // Bulk lifecycle over `n` contiguous objects (stride Size()): the constructor is resolved
+    // and its arguments bound once, then every element is built from the same arguments.
+    [[nodiscard]] std::expected<void, Error> ConstructArray(void *dst, NGIN::UIntSize n, const Any *args, NGIN::UIntSize count) const;
+    [[nodiscard]] std::expected<void, Error> ConstructArray(void *dst, NGIN::UIntSize n, std::span<const Any> args) const
+    {
+      return ConstructArray(dst, n, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+    [[nodiscard]] std::expected<void, Error> DestroyArray(void *dst, NGIN::UIntSize n) const;
+    [[nodiscard]] std::expected<void, Error> MoveConstruct(void *dst, void *src) const;
+    [[nodiscard]] std::expected<void, Error> CopyConstruct(void *dst, const void *src) const;
+    // Slab pool of this type with `capacity` slots per slab (see ObjectPool.hpp).
+    [[nodiscard]] std::expected<ObjectPool, Error> CreatePool(NGIN::UIntSize capacity) const;
+
+    // Resolve once for an argument shape (same scoring as Construct), then construct from the plan.
+    [[nodiscard]] std::expected<ResolvedConstructor, Error> ResolveConstructor(const Any *args, NGIN::UIntSize count) const;
+    [[nodiscard]] std::expected<ResolvedConstructor, Error> ResolveConstructor(std::span<const Any> args) const
+    {
+      return ResolveConstructor(args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    }
+    // Resolve by compile-time parameter types (exact match).
+    template <class... A>
+    [[nodiscard]] std::expected<ResolvedConstructor, Error> ResolveConstructor() const
+    {
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      const auto &reg = detail::GetRegistry();
+      if (!detail::IsTypeAlive(reg, m_h))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "stale handle"});
+      const auto &ctors = reg.types[m_h.index].constructors;
+      constexpr NGIN::UIntSize N = sizeof...(A);
+      const NGIN::UInt64 desired[N == 0 ? 1 : N] = {detail::TypeIdOf<A>()...};
+      for (NGIN::UIntSize k = 0; k < ctors.Size(); ++k)
+      {
+        const auto &c = ctors[k];
+        if (c.paramTypeIds.Size() != N)
+          continue;
+        bool all = true;
+        for (NGIN::UIntSize i = 0; i < N; ++i)
+        {
+          if (c.paramTypeIds[i] != desired[i])
+          {
+            all = false;
+            break;
+          }
+        }
+        if (!all)
+          continue;
+        detail::ArgPlan plan{};
+        plan.BuildExact(desired, N);
+        return ResolvedConstructor{ConstructorHandle{m_h.index, static_cast<NGIN::UInt32>(k), m_h.generation}, std::move(plan)};
+      }
+      return std::unexpected(Error{ErrorCode::NotFound, "no exact constructor"});
+    }
 
     [[nodiscard]] NGIN::UIntSize AttributeCount() const;
     [[nodiscard]] AttributeView AttributeAt(NGIN::UIntSize i) const;
@@ -1418,10 +2092,12 @@ namespace NGIN::Reflection
   [[nodiscard]] ExpectedFunction GetFunction(std::string_view name);
   [[nodiscard]] std::optional<Function> FindFunction(std::string_view name);
   [[nodiscard]] FunctionOverloads FindFunctions(std::string_view name);
-  [[nodiscard]] ExpectedResolvedFunction ResolveFunction(std::string_view name, const Any *args, NGIN::UIntSize count);
-  [[nodiscard]] inline ExpectedResolvedFunction ResolveFunction(std::string_view name, std::span<const Any> args)
+  [[nodiscard]] ExpectedResolvedFunction ResolveFunction(std::string_view name, const Any *args, NGIN::UIntSize count,
+                                                         ResolveOptions options = {});
+  [[nodiscard]] inline ExpectedResolvedFunction ResolveFunction(std::string_view name, std::span<const Any> args,
+                                                                ResolveOptions options = {})
   {
-    return ResolveFunction(name, args.data(), static_cast<NGIN::UIntSize>(args.size()));
+    return ResolveFunction(name, args.data(), static_cast<NGIN::UIntSize>(args.size()), options);
   }
 
   template <class R, class... A>
@@ -1456,6 +2132,14 @@ namespace NGIN::Reflection
       else
         return detail::TypeIdOf<std::remove_cv_t<std::remove_reference_t<R>>>();
     }();
+    // One lookup by signature hash; the scan only runs on a miss or a hash collision.
+    if (const auto *dispatch = reg.functionDispatch.GetPtr(nid))
+    {
+      const auto *fi = dispatch->bySignature.GetPtr(detail::TypedSignatureHash<R, A...>());
+      if (fi && detail::IsFunctionAlive(reg, FunctionHandle{*fi}) &&
+          detail::MatchesSignature(reg.functions[*fi], desiredRet, desired, N))
+        return Function{FunctionHandle{*fi}};
+    }
     bool anyAlive = false;
     for (NGIN::UIntSize k = 0; k < vec->Size(); ++k)
     {
@@ -1463,29 +2147,7 @@ namespace NGIN::Reflection
       if (!detail::IsFunctionAlive(reg, FunctionHandle{fi}))
         continue;
       anyAlive = true;
-      const auto &f = reg.functions[fi];
-      if constexpr (!std::is_void_v<R>)
-      {
-        if (f.returnTypeId != desiredRet)
-          continue;
-      }
-      else
-      {
-        if (f.returnTypeId != 0)
-          continue;
-      }
-      if (f.paramTypeIds.Size() != N)
-        continue;
-      bool all = true;
-      for (NGIN::UIntSize i = 0; i < N; ++i)
-      {
-        if (f.paramTypeIds[i] != desired[i])
-        {
-          all = false;
-          break;
-        }
-      }
-      if (all)
+      if (detail::MatchesSignature(reg.functions[fi], desiredRet, desired, N))
         return Function{FunctionHandle{fi}};
     }
     if (!anyAlive)
@@ -1511,6 +2173,24 @@ namespace NGIN::Reflection
   std::optional<Type> FindType(std::string_view name);
   bool UnregisterModule(ModuleId moduleId);
 
+  // Statistics for the process-wide overload resolution cache used by
+  // Type::ResolveMethod, ResolveFunction and Type::Construct.
+  struct ResolutionCacheStats
+  {
+    NGIN::UInt64 hits{0};
+    NGIN::UInt64 misses{0};
+    NGIN::UIntSize entries{0};
+
+    [[nodiscard]] double HitRate() const noexcept
+    {
+      const auto total = hits + misses;
+      return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+  };
+  [[nodiscard]] ResolutionCacheStats GetResolutionCacheStats() noexcept;
+  // Drop all cached resolutions and reset the counters.
+  void ClearResolutionCache() noexcept;
+
   template <class T>
   Type GetType()
   {
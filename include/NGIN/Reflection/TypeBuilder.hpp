@@ -7,6 +7,14 @@
 #include <NGIN/Hashing/FNV.hpp>
 #include <NGIN/Meta/TypeTraits.hpp>
 #include <NGIN/Reflection/Convert.hpp>
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+#include <NGIN/Reflection/BinarySerializer.hpp>
+#include <NGIN/Reflection/JsonSerializer.hpp>
+#include <NGIN/Reflection/Equality.hpp>
+#endif
+#include <functional>
+#include <memory>
+#include <new>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -90,6 +98,13 @@ namespace NGIN::Reflection
     {
       using MemberT = detail::MemberTypeT<MemberPtr>;
       auto &reg = detail::GetRegistry();
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+      detail::RegisterFieldDependencies<MemberT>(reg.types[m_index].moduleId);
+#else
+      // Paths and mappers look reflected members up by type id.
+      if constexpr (detail::HasNginReflectWithTypeBuilder<MemberT> || detail::HasDescribeWithTypeBuilder<MemberT>)
+        detail::EnsureRegistered<MemberT>(reg.types[m_index].moduleId);
+#endif
       detail::FieldDescriptor f{};
       {
         auto svName = name.empty() ? detail::MemberNameFromPretty<MemberPtr>() : name;
@@ -109,11 +124,38 @@ namespace NGIN::Reflection
       f.GetConst = &detail::FieldGetterConst<MemberPtr>;
       f.Load = &detail::FieldLoad<MemberPtr>;
       f.Store = &detail::FieldStore<MemberPtr>;
+      f.GetView = &detail::FieldGetView<MemberPtr>;
+      f.GetMutView = &detail::FieldGetMutView<MemberPtr>;
+      f.offset = detail::FieldOffset<MemberPtr>();
+      f.triviallyCopyable = std::is_trivially_copyable_v<MemberT>;
+      f.bytewise = detail::IsBytewise<MemberT>;
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+      if constexpr (detail::NeedsBinaryCodec<MemberT>)
+      {
+        f.WriteBinary = &detail::EncodeBinaryThunk<MemberT>;
+        f.ReadBinary = &detail::DecodeBinaryThunk<MemberT>;
+        f.DeepEqual = &detail::DeepEqualThunk<MemberT>;
+        f.DeepHash = &detail::DeepHashThunk<MemberT>;
+      }
+      if constexpr (detail::NeedsJsonCodec<MemberT>)
+      {
+        f.WriteJson = &detail::EncodeJsonThunk<MemberT>;
+        f.ReadJson = &detail::DecodeJsonThunk<MemberT>;
+      }
+#endif
+      if constexpr (std::is_trivially_copyable_v<MemberT> || std::is_copy_assignable_v<MemberT>)
+      {
+        f.Gather = &detail::FieldGather<MemberPtr>;
+        f.Scatter = &detail::FieldScatter<MemberPtr>;
+      }
+      if constexpr (!std::is_trivially_copyable_v<MemberT> && std::is_copy_assignable_v<MemberT>)
+        f.CopyAssign = &detail::CopyAssignThunk<MemberT>;
       reg.types[m_index].fields.PushBack(std::move(f));
       // update Field index map
       const auto newIdx = static_cast<NGIN::UInt32>(reg.types[m_index].fields.Size() - 1);
       if (!reg.types[m_index].fields[newIdx].nameId.empty())
         reg.types[m_index].fieldIndex.Insert(reg.types[m_index].fields[newIdx].nameId, newIdx);
+      detail::BumpRegistryEpoch();
       return *this;
     }
 
@@ -139,6 +181,11 @@ namespace NGIN::Reflection
     template <class... A>
     TypeBuilder &Constructor();
 
+    // Declare a user-defined conversion T -> U used by overload resolution. Fn is invoked
+    // with a const T& (free function or const member function). Lower cost (1..100) is preferred.
+    template <class U, auto Fn>
+    TypeBuilder &ConvertsTo(int cost = 1);
+
     // Register a base type and upcast hooks.
     template <class BaseT>
     TypeBuilder &Base();
@@ -369,8 +416,9 @@ namespace NGIN::Reflection
       static constexpr bool IsMember = false;
     };
 
+    // Calls the getter and returns its result unchanged (value or reference).
     template <auto Getter>
-    inline Any PropertyGet(const void *obj)
+    inline decltype(auto) CallGetter(const void *obj)
     {
       using Traits = GetterTraits<decltype(Getter)>;
       using C = typename Traits::Class;
@@ -379,12 +427,12 @@ namespace NGIN::Reflection
         if constexpr (Traits::IsConst)
         {
           auto *c = static_cast<const C *>(obj);
-          return Any{(c->*Getter)()};
+          return (c->*Getter)();
         }
         else
         {
           auto *c = const_cast<C *>(static_cast<const C *>(obj));
-          return Any{(c->*Getter)()};
+          return (c->*Getter)();
         }
       }
       else
@@ -392,16 +440,34 @@ namespace NGIN::Reflection
         if constexpr (Traits::IsConst)
         {
           const auto &c = *static_cast<const C *>(obj);
-          return Any{Getter(c)};
+          return Getter(c);
         }
         else
         {
           auto &c = *const_cast<C *>(static_cast<const C *>(obj));
-          return Any{Getter(c)};
+          return Getter(c);
         }
       }
     }
 
+    template <auto Getter>
+    inline Any PropertyGet(const void *obj)
+    {
+      return Any{CallGetter<Getter>(obj)};
+    }
+
+    template <auto Getter>
+    inline ConstAnyView PropertyGetView(const void *obj)
+    {
+      return Any::FromConstRef(CallGetter<Getter>(obj));
+    }
+
+    template <auto Getter>
+    inline AnyView PropertyGetMutView(void *obj)
+    {
+      return Any::FromRef(CallGetter<Getter>(obj));
+    }
+
     template <auto Setter>
     static std::expected<void, Error> PropertySet(void *obj, const Any &value)
     {
@@ -468,6 +534,79 @@ namespace NGIN::Reflection
       (v.PushBack(ParamTypeId<I, Tuple>()), ...);
     }
 
+    template <class Tuple, std::size_t... I>
+    inline constexpr NGIN::UInt64 OutParamMask(std::index_sequence<I...>)
+    {
+      return ((IsOutParamV<std::tuple_element_t<I, Tuple>> ? (NGIN::UInt64{1} << I) : NGIN::UInt64{0}) | ... | NGIN::UInt64{0});
+    }
+
+    // Shared body of the invoke thunks: binds each argument into an ArgSlot (reference
+    // parameters bind to caller memory through views) and forwards them to `call`.
+    template <class R, class... A>
+    struct ThunkCall
+    {
+      template <bool Exact, class F, std::size_t... I>
+      static std::expected<Any, Error> Run(const Any *args, F &&call, std::index_sequence<I...>)
+      {
+        std::tuple<ArgSlot<A>...> slots;
+        if constexpr (Exact)
+        {
+          if (!(std::get<I>(slots).BindExact(args[I]) && ...))
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+        }
+        else
+        {
+          if (!(std::get<I>(slots).Bind(args[I]) && ...))
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        }
+        if constexpr (std::is_void_v<R>)
+        {
+          call(std::get<I>(slots).Get()...);
+          return Any::MakeVoid();
+        }
+        else
+        {
+          auto r = call(std::get<I>(slots).Get()...);
+          return Any{std::move(r)};
+        }
+      }
+
+      // Bind each argument through the converter picked for it at resolve time.
+      template <class F, std::size_t... I>
+      static std::expected<Any, Error> RunConverted(const Any *args, const ArgConverter *converters, F &&call,
+                                                    std::index_sequence<I...>)
+      {
+        std::tuple<ArgSlot<A>...> slots;
+        if (!(std::get<I>(slots).BindConverted(args[I], converters[I]) && ...))
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        if constexpr (std::is_void_v<R>)
+        {
+          call(std::get<I>(slots).Get()...);
+          return Any::MakeVoid();
+        }
+        else
+        {
+          auto r = call(std::get<I>(slots).Get()...);
+          return Any{std::move(r)};
+        }
+      }
+
+      // For lvalue-reference returns: view the referenced object instead of copying it.
+      template <class ViewT, class F, std::size_t... I>
+      static std::expected<ViewT, Error> RunView(const Any *args, F &&call, std::index_sequence<I...>)
+      {
+        static_assert(std::is_lvalue_reference_v<R>, "RunView requires a reference return type");
+        std::tuple<ArgSlot<A>...> slots;
+        if (!(std::get<I>(slots).Bind(args[I]) && ...))
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        auto &r = call(std::get<I>(slots).Get()...);
+        if constexpr (std::is_same_v<ViewT, AnyView>)
+          return Any::FromRef(r);
+        else
+          return Any::FromConstRef(r);
+      }
+    };
+
     template <class C, class R, class... A>
     struct MethodTraits<R (C::*)(A...)>
     {
@@ -494,43 +633,42 @@ namespace NGIN::Reflection
         return CallExact<MemFn>(c, args, std::index_sequence_for<A...>{});
       }
 
+      template <auto MemFn>
+      static std::expected<Any, Error> InvokeConverted(void *obj, const Any *args, NGIN::UIntSize count,
+                                                       const ArgConverter *converters)
+      {
+        if (count != Arity)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        auto *c = static_cast<C *>(obj);
+        return ThunkCall<R, A...>::RunConverted(args, converters, [c](auto &&...a) -> decltype(auto)
+                                                { return (c->*MemFn)(std::forward<decltype(a)>(a)...); },
+                                                std::index_sequence_for<A...>{});
+      }
+
+      template <auto MemFn, class ViewT>
+      static std::expected<ViewT, Error> InvokeView(void *obj, const Any *args, NGIN::UIntSize count)
+      {
+        if (count != Arity)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        auto *c = static_cast<C *>(obj);
+        return ThunkCall<R, A...>::template RunView<ViewT>(args, [c](auto &&...a) -> decltype(auto)
+                                                           { return (c->*MemFn)(std::forward<decltype(a)>(a)...); },
+                                                           std::index_sequence_for<A...>{});
+      }
+
     private:
       template <auto MemFn, std::size_t... I>
-      static std::expected<Any, Error> Call(C *c, const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> Call(C *c, const Any *args, std::index_sequence<I...> seq)
       {
-        if (((ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).has_value()) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            (c->*MemFn)(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = (c->*MemFn)(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        return ThunkCall<R, A...>::template Run<false>(args, [c](auto &&...a) -> decltype(auto)
+                                                       { return (c->*MemFn)(std::forward<decltype(a)>(a)...); }, seq);
       }
 
       template <auto MemFn, std::size_t... I>
-      static std::expected<Any, Error> CallExact(C *c, const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> CallExact(C *c, const Any *args, std::index_sequence<I...> seq)
       {
-        if ((ArgMatchesExact<A>(args[I]) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            (c->*MemFn)(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = (c->*MemFn)(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+        return ThunkCall<R, A...>::template Run<true>(args, [c](auto &&...a) -> decltype(auto)
+                                                      { return (c->*MemFn)(std::forward<decltype(a)>(a)...); }, seq);
       }
     };
 
@@ -560,43 +698,42 @@ namespace NGIN::Reflection
         return CallExact<MemFn>(c, args, std::index_sequence_for<A...>{});
       }
 
+      template <auto MemFn>
+      static std::expected<Any, Error> InvokeConverted(void *obj, const Any *args, NGIN::UIntSize count,
+                                                       const ArgConverter *converters)
+      {
+        if (count != Arity)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        auto *c = static_cast<const C *>(obj);
+        return ThunkCall<R, A...>::RunConverted(args, converters, [c](auto &&...a) -> decltype(auto)
+                                                { return (c->*MemFn)(std::forward<decltype(a)>(a)...); },
+                                                std::index_sequence_for<A...>{});
+      }
+
+      template <auto MemFn, class ViewT>
+      static std::expected<ViewT, Error> InvokeView(void *obj, const Any *args, NGIN::UIntSize count)
+      {
+        if (count != Arity)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        auto *c = static_cast<const C *>(obj);
+        return ThunkCall<R, A...>::template RunView<ViewT>(args, [c](auto &&...a) -> decltype(auto)
+                                                           { return (c->*MemFn)(std::forward<decltype(a)>(a)...); },
+                                                           std::index_sequence_for<A...>{});
+      }
+
     private:
       template <auto MemFn, std::size_t... I>
-      static std::expected<Any, Error> Call(const C *c, const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> Call(const C *c, const Any *args, std::index_sequence<I...> seq)
       {
-        if (((ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).has_value()) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            (c->*MemFn)(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = (c->*MemFn)(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        return ThunkCall<R, A...>::template Run<false>(args, [c](auto &&...a) -> decltype(auto)
+                                                       { return (c->*MemFn)(std::forward<decltype(a)>(a)...); }, seq);
       }
 
       template <auto MemFn, std::size_t... I>
-      static std::expected<Any, Error> CallExact(const C *c, const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> CallExact(const C *c, const Any *args, std::index_sequence<I...> seq)
       {
-        if ((ArgMatchesExact<A>(args[I]) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            (c->*MemFn)(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = (c->*MemFn)(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+        return ThunkCall<R, A...>::template Run<true>(args, [c](auto &&...a) -> decltype(auto)
+                                                      { return (c->*MemFn)(std::forward<decltype(a)>(a)...); }, seq);
       }
     };
 
@@ -626,43 +763,29 @@ namespace NGIN::Reflection
         return CallExact<Fn>(args, std::index_sequence_for<A...>{});
       }
 
+      template <auto Fn>
+      static std::expected<Any, Error> InvokeConverted(const Any *args, NGIN::UIntSize count, const ArgConverter *converters)
+      {
+        if (count != Arity)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        return ThunkCall<R, A...>::RunConverted(args, converters, [](auto &&...a) -> decltype(auto)
+                                                { return Fn(std::forward<decltype(a)>(a)...); },
+                                                std::index_sequence_for<A...>{});
+      }
+
     private:
       template <auto Fn, std::size_t... I>
-      static std::expected<Any, Error> Call(const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> Call(const Any *args, std::index_sequence<I...> seq)
       {
-        if (((ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).has_value()) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            Fn(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = Fn(ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[I]).value()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        return ThunkCall<R, A...>::template Run<false>(args, [](auto &&...a) -> decltype(auto)
+                                                       { return Fn(std::forward<decltype(a)>(a)...); }, seq);
       }
 
       template <auto Fn, std::size_t... I>
-      static std::expected<Any, Error> CallExact(const Any *args, std::index_sequence<I...>)
+      static std::expected<Any, Error> CallExact(const Any *args, std::index_sequence<I...> seq)
       {
-        if ((ArgMatchesExact<A>(args[I]) && ...))
-        {
-          if constexpr (std::is_void_v<R>)
-          {
-            Fn(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any::MakeVoid();
-          }
-          else
-          {
-            auto r = Fn(args[I].template Cast<std::remove_cv_t<std::remove_reference_t<A>>>()...);
-            return Any{std::move(r)};
-          }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument type mismatch"});
+        return ThunkCall<R, A...>::template Run<true>(args, [](auto &&...a) -> decltype(auto)
+                                                      { return Fn(std::forward<decltype(a)>(a)...); }, seq);
       }
     };
 
@@ -682,16 +805,18 @@ namespace NGIN::Reflection
       }
       else
       {
-        auto rsv = NGIN::Meta::TypeName<typename Traits::Ret>::qualifiedName;
-        f.returnTypeId = NGIN::Hashing::FNV1a64(rsv.data(), rsv.size());
+        f.returnTypeId = detail::TypeIdOf<typename Traits::Ret>();
       }
       if constexpr (Traits::Arity > 0)
       {
         using Tuple = typename Traits::Args;
         detail::PushCtorParamIds<Tuple>(f.paramTypeIds, std::make_index_sequence<Traits::Arity>{});
+        f.outParamMask = detail::OutParamMask<Tuple>(std::make_index_sequence<Traits::Arity>{});
       }
+      f.signatureHash = detail::SignatureHash(f.returnTypeId, f.paramTypeIds);
       f.Invoke = &Traits::template Invoke<Fn>;
       f.InvokeExact = &Traits::template InvokeExact<Fn>;
+      f.InvokeConverted = &Traits::template InvokeConverted<Fn>;
       f.moduleId = moduleId;
       f.alive = true;
       reg.functions.PushBack(std::move(f));
@@ -707,6 +832,14 @@ namespace NGIN::Reflection
       {
         vecPtr->PushBack(newIndex);
       }
+      auto *dispatch = reg.functionDispatch.GetPtr(reg.functions[newIndex].nameId);
+      if (!dispatch)
+      {
+        reg.functionDispatch.Insert(reg.functions[newIndex].nameId, detail::OverloadDispatch{});
+        dispatch = reg.functionDispatch.GetPtr(reg.functions[newIndex].nameId);
+      }
+      detail::AddOverload(*dispatch, newIndex, reg.functions[newIndex].paramTypeIds, reg.functions[newIndex].signatureHash);
+      detail::BumpRegistryEpoch();
       return Function{FunctionHandle{newIndex}};
     }
   } // namespace detail
@@ -722,15 +855,14 @@ namespace NGIN::Reflection
     auto nameId = detail::InternNameId(reg.types[m_index].moduleId, name);
     m.name = detail::NameFromId(nameId);
     m.nameId = nameId;
-    // Return type id
+    // Return type id (references report the referenced type)
     if constexpr (std::is_void_v<typename Traits::Ret>)
     {
       m.returnTypeId = 0;
     }
     else
     {
-      auto rsv = NGIN::Meta::TypeName<typename Traits::Ret>::qualifiedName;
-      m.returnTypeId = NGIN::Hashing::FNV1a64(rsv.data(), rsv.size());
+      m.returnTypeId = detail::TypeIdOf<typename Traits::Ret>();
     }
     // Param type ids
     constexpr auto N = Traits::Arity;
@@ -738,11 +870,20 @@ namespace NGIN::Reflection
     {
       using Tuple = typename Traits::Args;
       detail::PushParamIds<Tuple>(m, std::make_index_sequence<N>{});
+      m.outParamMask = detail::OutParamMask<Tuple>(std::make_index_sequence<N>{});
     }
     m.isConst = Traits::IsConst;
+    m.signatureHash = detail::SignatureHash(m.returnTypeId, m.paramTypeIds);
     // Invoker
     m.Invoke = &Traits::template Invoke<MemFn>;
     m.InvokeExact = &Traits::template InvokeExact<MemFn>;
+    m.InvokeConverted = &Traits::template InvokeConverted<MemFn>;
+    if constexpr (std::is_lvalue_reference_v<typename Traits::Ret>)
+    {
+      m.InvokeView = &Traits::template InvokeView<MemFn, ConstAnyView>;
+      if constexpr (!std::is_const_v<std::remove_reference_t<typename Traits::Ret>>)
+        m.InvokeMutView = &Traits::template InvokeView<MemFn, AnyView>;
+    }
     reg.types[m_index].methods.PushBack(std::move(m));
     // Add to overload set map
     auto &tdesc = reg.types[m_index];
@@ -758,6 +899,14 @@ namespace NGIN::Reflection
     {
       vecPtr->PushBack(newIndex);
     }
+    auto *dispatch = tdesc.methodDispatch.GetPtr(tdesc.methods[newIndex].nameId);
+    if (!dispatch)
+    {
+      tdesc.methodDispatch.Insert(tdesc.methods[newIndex].nameId, detail::OverloadDispatch{});
+      dispatch = tdesc.methodDispatch.GetPtr(tdesc.methods[newIndex].nameId);
+    }
+    detail::AddOverload(*dispatch, newIndex, tdesc.methods[newIndex].paramTypeIds, tdesc.methods[newIndex].signatureHash);
+    detail::BumpRegistryEpoch();
     return *this;
   }
 
@@ -788,8 +937,11 @@ namespace NGIN::Reflection
     auto sv = NGIN::Meta::TypeName<Value>::qualifiedName;
     p.typeId = NGIN::Hashing::FNV1a64(sv.data(), sv.size());
     p.Get = &detail::PropertyGet<Getter>;
+    if constexpr (std::is_lvalue_reference_v<Ret>)
+      p.GetView = &detail::PropertyGetView<Getter>;
     if constexpr (std::is_lvalue_reference_v<Ret> && !std::is_const_v<std::remove_reference_t<Ret>>)
     {
+      p.GetMutView = &detail::PropertyGetMutView<Getter>;
       p.Set = &detail::PropertySetFromGetter<Getter>;
     }
     reg.types[m_index].properties.PushBack(std::move(p));
@@ -816,6 +968,10 @@ namespace NGIN::Reflection
     auto sv = NGIN::Meta::TypeName<Value>::qualifiedName;
     p.typeId = NGIN::Hashing::FNV1a64(sv.data(), sv.size());
     p.Get = &detail::PropertyGet<Getter>;
+    if constexpr (std::is_lvalue_reference_v<Ret>)
+      p.GetView = &detail::PropertyGetView<Getter>;
+    if constexpr (std::is_lvalue_reference_v<Ret> && !std::is_const_v<std::remove_reference_t<Ret>>)
+      p.GetMutView = &detail::PropertyGetMutView<Getter>;
     p.Set = &detail::PropertySet<Setter>;
     reg.types[m_index].properties.PushBack(std::move(p));
     const auto newIdx = static_cast<NGIN::UInt32>(reg.types[m_index].properties.Size() - 1);
@@ -916,34 +1072,108 @@ namespace NGIN::Reflection
     {
       using Tuple = std::tuple<A...>;
       detail::PushCtorParamIds<Tuple>(c.paramTypeIds, std::make_index_sequence<sizeof...(A)>{});
+      c.outParamMask = detail::OutParamMask<Tuple>(std::make_index_sequence<sizeof...(A)>{});
     }
     c.Construct = [](const Any *args, NGIN::UIntSize count) -> std::expected<Any, Error>
     {
       if (count != sizeof...(A))
         return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
-      // Convert then construct
-      auto convert_and_make = [&](auto &&...unpacked) -> std::expected<Any, Error>
+      // Bind (converting where needed) then construct
+      return detail::ThunkCall<T, A...>::template Run<false>(args, [](auto &&...a)
+                                                             { return T{std::forward<decltype(a)>(a)...}; },
+                                                             std::make_index_sequence<sizeof...(A)>{});
+    };
+    c.ConstructExact = [](const Any *args, NGIN::UIntSize count) -> std::expected<Any, Error>
+    {
+      if (count != sizeof...(A))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+      return detail::ThunkCall<T, A...>::template Run<true>(args, [](auto &&...a)
+                                                            { return T{std::forward<decltype(a)>(a)...}; },
+                                                            std::make_index_sequence<sizeof...(A)>{});
+    };
+    c.ConstructConverted = [](const Any *args, NGIN::UIntSize count, const detail::ArgConverter *converters) -> std::expected<Any, Error>
+    {
+      if (count != sizeof...(A))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+      return detail::ThunkCall<T, A...>::RunConverted(args, converters, [](auto &&...a)
+                                                      { return T{std::forward<decltype(a)>(a)...}; },
+                                                      std::make_index_sequence<sizeof...(A)>{});
+    };
+    c.ConstructAt = [](void *storage, const Any *args, NGIN::UIntSize count,
+                       const detail::ArgConverter *converters) -> std::expected<void, Error>
+    {
+      if (count != sizeof...(A))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+      auto place = [storage](auto &&...a)
+      { ::new (storage) T{std::forward<decltype(a)>(a)...}; };
+      auto r = converters
+                   ? detail::ThunkCall<void, A...>::RunConverted(args, converters, place, std::make_index_sequence<sizeof...(A)>{})
+                   : detail::ThunkCall<void, A...>::template Run<false>(args, place, std::make_index_sequence<sizeof...(A)>{});
+      if (!r.has_value())
+        return std::unexpected(r.error());
+      return {};
+    };
+    // Arguments are bound once and passed as lvalues to every element, so parameters that
+    // only accept rvalues fall back to per-element ConstructAt in Type::ConstructArray.
+    if constexpr (requires(std::remove_reference_t<A> &...a) { T{a...}; })
+    {
+      c.ConstructArray = [](void *storage, NGIN::UIntSize n, const Any *args, NGIN::UIntSize count,
+                            const detail::ArgConverter *converters) -> std::expected<void, Error>
       {
-        if (((detail::ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[unpacked]).has_value()) && ...))
+        if (count != sizeof...(A))
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "bad arity"});
+        auto fill = [storage, n](auto &&...a)
         {
-          if constexpr (sizeof...(A) == 0)
+          auto *first = static_cast<T *>(storage);
+          NGIN::UIntSize i = 0;
+          try
           {
-            return Any{T{}};
+            for (; i < n; ++i)
+              ::new (static_cast<void *>(first + i)) T{a...};
           }
-          else
+          catch (...)
           {
-            T obj{detail::ConvertAny<std::remove_cv_t<std::remove_reference_t<A>>>(args[unpacked]).value()...};
-            return Any{std::move(obj)};
+            std::destroy_n(first, i);
+            throw;
           }
-        }
-        return std::unexpected(Error{ErrorCode::InvalidArgument, "argument conversion failed"});
+        };
+        auto r = converters
+                     ? detail::ThunkCall<void, A...>::RunConverted(args, converters, fill, std::make_index_sequence<sizeof...(A)>{})
+                     : detail::ThunkCall<void, A...>::template Run<false>(args, fill, std::make_index_sequence<sizeof...(A)>{});
+        if (!r.has_value())
+          return std::unexpected(r.error());
+        return {};
       };
-      return [&]<std::size_t... I>(std::index_sequence<I...>)
-      {
-        return convert_and_make(I...);
-      }(std::make_index_sequence<sizeof...(A)>{});
-    };
+    }
     reg.types[m_index].constructors.PushBack(std::move(c));
+    detail::BumpRegistryEpoch();
+    return *this;
+  }
+
+  namespace detail
+  {
+    template <class From, class To, auto Fn>
+    void ConvertWith(const void *src, void *dst)
+    {
+      ::new (dst) To(std::invoke(Fn, *static_cast<const From *>(src)));
+    }
+  } // namespace detail
+
+  template <class T>
+  template <class U, auto Fn>
+  inline TypeBuilder<T> &TypeBuilder<T>::ConvertsTo(int cost)
+  {
+    using To = std::remove_cv_t<std::remove_reference_t<U>>;
+    static_assert(std::is_invocable_r_v<To, decltype(Fn), const T &>, "ConvertsTo requires Fn(const T&) -> U");
+    static_assert(!std::is_same_v<To, T>, "ConvertsTo target must differ from T");
+    auto &reg = detail::GetRegistry();
+    detail::ConversionEdge e{};
+    e.from = detail::TypeIdOf<T>();
+    e.to = detail::TypeIdOf<To>();
+    e.convert = &detail::ConvertWith<T, To, Fn>;
+    e.cost = cost < 1 ? 1 : (cost > 100 ? 100 : cost);
+    e.moduleId = reg.types[m_index].moduleId;
+    detail::RegisterConversion(e);
     return *this;
   }
 
@@ -4,16 +4,30 @@
 
 #include <NGIN/Primitives.hpp>
 #include <NGIN/Utilities/Any.hpp>
+#include <NGIN/Reflection/AnyArena.hpp>
 #include <NGIN/Containers/Vector.hpp>
 #include <string_view>
 #include <expected>
 #include <utility>
 #include <optional>
+#include <cstddef>
+
+// Small-buffer size of the Any used for reflected arguments and results. Set per build with
+// the NGIN_REFLECTION_ANY_SBO_BYTES CMake cache variable so the library and its consumers agree.
+#ifndef NGIN_REFLECTION_ANY_SBO_BYTES
+#define NGIN_REFLECTION_ANY_SBO_BYTES 32
+#endif
 
 namespace NGIN::Reflection
 {
 
-  using Any = NGIN::Utilities::Any<>;
+  inline constexpr NGIN::UIntSize kAnySmallBufferBytes = NGIN_REFLECTION_ANY_SBO_BYTES;
+  static_assert(kAnySmallBufferBytes >= sizeof(void *), "NGIN_REFLECTION_ANY_SBO_BYTES is too small");
+
+  // Heap spills go through AnyArenaAllocator so an AnyArenaScope can capture them.
+  using Any = NGIN::Utilities::Any<kAnySmallBufferBytes, alignof(std::max_align_t), detail::AnyArenaAllocator>;
+  using AnyView = Any::View;
+  using ConstAnyView = Any::ConstView;
   using ModuleId = NGIN::UInt64;
 
   enum class ErrorCode : unsigned
@@ -46,8 +60,12 @@ namespace NGIN::Reflection
   {
     ErrorCode code{ErrorCode::InvalidArgument};
     std::string_view message{};
-    NGIN::Containers::Vector<OverloadDiagnostic> diagnostics{};
+    NGIN::Containers::Vector<OverloadDiagnostic> diagnostics{}; // only with ResolveOptions::collectDiagnostics
     std::optional<NGIN::UInt32> closestMethodIndex{};
+    // Compact failure record of the closest candidate; always filled, never allocates.
+    DiagnosticCode reason{DiagnosticCode::None};
+    NGIN::UIntSize argIndex{static_cast<NGIN::UIntSize>(-1)};
+    NGIN::UInt32 candidateCount{0};
 
     constexpr Error() = default;
     Error(ErrorCode c, std::string_view m) : code(c), message(m) {}
@@ -57,6 +75,13 @@ namespace NGIN::Reflection
     }
   };
 
+  struct ResolveOptions
+  {
+    // Fill Error::diagnostics with one entry per candidate when resolution fails. Off by
+    // default so speculative resolution does not allocate on failure.
+    bool collectDiagnostics{false};
+  };
+
   // Small opaque handles (indices into immutable tables). Intentionally trivial.
   struct TypeHandle
   {
@@ -140,6 +140,9 @@ bool NGIN::Reflection::MergeRegistryV1(const NGINReflectionRegistryV1 &module,
   [[maybe_unused]] auto lock = detail::LockRegistryWrite();
   auto &reg = GetRegistry();
   std::uint64_t added = 0, conflicted = 0;
+  // Merged records may replace existing ones; invalidate resolution caches up front
+  // so a partially applied (failed) merge is covered as well.
+  detail::BumpRegistryEpoch();
 
   auto removeNameIndex = [&](NameId id, NGIN::UInt32 index)
   {
@@ -290,6 +293,7 @@ bool NGIN::Reflection::MergeRegistryV1(const NGINReflectionRegistryV1 &module,
           for (std::uint32_t k = 0; k < mi.paramCount; ++k)
             md.paramTypeIds.PushBack(params[mi.paramBegin + k]);
         }
+        md.signatureHash = detail::SignatureHash(md.returnTypeId, md.paramTypeIds);
         if (mi.attrCount)
         {
           md.attributes.Reserve(mi.attrCount);
@@ -315,6 +319,13 @@ bool NGIN::Reflection::MergeRegistryV1(const NGINReflectionRegistryV1 &module,
           v.PushBack(methodIdx);
           rec.methodOverloads.Insert(nameId, std::move(v));
         }
+        auto *dispatch = rec.methodDispatch.GetPtr(nameId);
+        if (!dispatch)
+        {
+          rec.methodDispatch.Insert(nameId, detail::OverloadDispatch{});
+          dispatch = rec.methodDispatch.GetPtr(nameId);
+        }
+        detail::AddOverload(*dispatch, methodIdx, rec.methods[methodIdx].paramTypeIds, rec.methods[methodIdx].signatureHash);
       }
     }
 
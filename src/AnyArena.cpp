@@ -0,0 +1,128 @@
+#include <NGIN/Reflection/AnyArena.hpp>
+
+#include <NGIN/Memory/SystemAllocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NGIN::Reflection::detail
+{
+  namespace
+  {
+    // The byte in front of every block records who owns it.
+    constexpr unsigned char kArenaTag = 0xA7;
+    constexpr unsigned char kHeapTag = 0x5E;
+    constexpr NGIN::UIntSize kChunkAlign = alignof(std::max_align_t);
+
+    thread_local AnyArenaScope *t_current = nullptr;
+    std::atomic<NGIN::UInt64> g_arenaAllocations{0};
+    std::atomic<NGIN::UInt64> g_heapAllocations{0};
+
+    constexpr NGIN::UIntSize HeapPrefix(NGIN::UIntSize alignment) noexcept
+    {
+      return alignment > kChunkAlign ? alignment : kChunkAlign;
+    }
+
+    unsigned char *AlignUp(unsigned char *p, NGIN::UIntSize alignment) noexcept
+    {
+      const auto v = reinterpret_cast<std::uintptr_t>(p);
+      return reinterpret_cast<unsigned char *>((v + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+    }
+  } // namespace
+
+  void *AnyArenaAllocator::Allocate(NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept
+  {
+    if (alignment == 0)
+      alignment = 1;
+    if (auto *arena = t_current)
+    {
+      if (auto *p = static_cast<unsigned char *>(arena->Allocate(bytes, alignment)))
+      {
+        p[-1] = kArenaTag;
+        g_arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+        return p;
+      }
+    }
+    const auto prefix = HeapPrefix(alignment);
+    NGIN::Memory::SystemAllocator alloc{};
+    auto *raw = static_cast<unsigned char *>(alloc.Allocate(bytes + prefix, prefix));
+    if (!raw)
+      return nullptr;
+    raw[prefix - 1] = kHeapTag;
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return raw + prefix;
+  }
+
+  void AnyArenaAllocator::Deallocate(void *ptr, NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept
+  {
+    if (!ptr)
+      return;
+    auto *p = static_cast<unsigned char *>(ptr);
+    // Monotonic: arena blocks are reclaimed when their scope ends.
+    if (p[-1] == kArenaTag)
+      return;
+    const auto prefix = HeapPrefix(alignment == 0 ? 1 : alignment);
+    NGIN::Memory::SystemAllocator alloc{};
+    alloc.Deallocate(p - prefix, bytes + prefix, prefix);
+  }
+} // namespace NGIN::Reflection::detail
+
+namespace NGIN::Reflection
+{
+  AnyArenaScope::AnyArenaScope(NGIN::UIntSize chunkBytes) noexcept
+      : m_previous(detail::t_current), m_chunkBytes(chunkBytes < 256 ? 256 : chunkBytes)
+  {
+    detail::t_current = this;
+  }
+
+  AnyArenaScope::~AnyArenaScope()
+  {
+    detail::t_current = m_previous;
+    NGIN::Memory::SystemAllocator alloc{};
+    while (m_chunks)
+    {
+      auto *next = m_chunks->next;
+      alloc.Deallocate(m_chunks, m_chunks->size, detail::kChunkAlign);
+      m_chunks = next;
+    }
+  }
+
+  void *AnyArenaScope::Allocate(NGIN::UIntSize bytes, NGIN::UIntSize alignment) noexcept
+  {
+    // One tag byte must fit in front of the aligned block.
+    auto *p = m_cursor ? detail::AlignUp(m_cursor + 1, alignment) : nullptr;
+    if (!p || p + bytes > m_end)
+    {
+      const auto need = sizeof(Chunk) + 1 + alignment + bytes;
+      const auto size = need > m_chunkBytes ? need : m_chunkBytes;
+      NGIN::Memory::SystemAllocator alloc{};
+      auto *chunk = static_cast<Chunk *>(alloc.Allocate(size, detail::kChunkAlign));
+      if (!chunk)
+        return nullptr;
+      chunk->next = m_chunks;
+      chunk->size = size;
+      m_chunks = chunk;
+      m_cursor = reinterpret_cast<unsigned char *>(chunk + 1);
+      m_end = reinterpret_cast<unsigned char *>(chunk) + size;
+      p = detail::AlignUp(m_cursor + 1, alignment);
+    }
+    m_used += static_cast<NGIN::UIntSize>(p + bytes - m_cursor);
+    m_cursor = p + bytes;
+    return p;
+  }
+
+  AnyArenaStats GetAnyArenaStats() noexcept
+  {
+    AnyArenaStats stats{};
+    stats.arenaAllocations = detail::g_arenaAllocations.load(std::memory_order_relaxed);
+    stats.heapAllocations = detail::g_heapAllocations.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  void ResetAnyArenaStats() noexcept
+  {
+    detail::g_arenaAllocations.store(0, std::memory_order_relaxed);
+    detail::g_heapAllocations.store(0, std::memory_order_relaxed);
+  }
+} // namespace NGIN::Reflection
@@ -0,0 +1,222 @@
+#include <NGIN/Reflection/BinarySerializer.hpp>
+#include <NGIN/Reflection/PlanCache.hpp>
+
+namespace NGIN::Reflection
+{
+  namespace
+  {
+    enum class StepKind : NGIN::UInt8
+    {
+      Span,   // memcpy of `size` bytes
+      Codec,  // field codec thunk
+      Nested, // plan of the member's reflected type
+    };
+
+    struct Step
+    {
+      StepKind kind{StepKind::Span};
+      detail::MemberAccess at{};
+      NGIN::UIntSize size{0};
+      std::expected<void, Error> (*write)(const void *, BinarySerializer &, BinaryWriter &){nullptr};
+      std::expected<void, Error> (*read)(void *, BinarySerializer &, BinaryReader &){nullptr};
+      NGIN::UInt32 nested{0};
+    };
+
+    struct Plan
+    {
+      NGIN::Containers::Vector<Step> steps;
+    };
+  } // namespace
+
+  struct BinarySerializer::State
+  {
+    detail::PlanCache<Plan> plans;
+
+    // Caller holds the registry read lock.
+    std::expected<NGIN::UInt32, Error> Compile(const detail::Registry &reg, NGIN::UInt64 typeId)
+    {
+      return plans.Compile(reg, typeId, [&](const detail::TypeDescriptor &desc, Plan &plan) { return Build(reg, desc, plan); });
+    }
+
+    std::expected<void, Error> Build(const detail::Registry &reg, const detail::TypeDescriptor &desc, Plan &plan)
+    {
+      for (NGIN::UIntSize i = 0; i < desc.fields.Size(); ++i)
+      {
+        const auto &f = desc.fields[i];
+        Step step{};
+        step.at = detail::MemberAccess::Of(f);
+
+        if (f.triviallyCopyable)
+        {
+          step.kind = StepKind::Span;
+          step.size = f.sizeBytes;
+          // Coalesce with the previous span when the two fields touch in memory.
+          if (plan.steps.Size() > 0)
+          {
+            auto &prev = plan.steps[plan.steps.Size() - 1];
+            if (prev.kind == StepKind::Span && prev.at.Abuts(prev.size, step.at))
+            {
+              prev.size += step.size;
+              continue;
+            }
+          }
+        }
+        else if (const auto codecs = detail::FieldCodecs::Of(f); codecs.writeBinary && codecs.readBinary)
+        {
+          step.kind = StepKind::Codec;
+          step.write = codecs.writeBinary;
+          step.read = codecs.readBinary;
+        }
+        else
+        {
+          // A reflected member without fields would silently serialize as nothing.
+          const auto *nestedIndex = reg.byTypeId.GetPtr(f.typeId);
+          if (!nestedIndex || reg.types[*nestedIndex].fields.Size() == 0)
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+          auto nested = Compile(reg, f.typeId);
+          if (!nested.has_value())
+            return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+          step.kind = StepKind::Nested;
+          step.nested = *nested;
+        }
+        plan.steps.PushBack(step);
+      }
+      return {};
+    }
+  };
+
+  BinarySerializer::BinarySerializer() : m_state(std::make_unique<State>()) {}
+  BinarySerializer::~BinarySerializer() = default;
+  BinarySerializer::BinarySerializer(BinarySerializer &&) noexcept = default;
+  BinarySerializer &BinarySerializer::operator=(BinarySerializer &&) noexcept = default;
+
+  NGIN::UIntSize BinarySerializer::PlanCount() const noexcept { return m_state ? m_state->plans.Size() : 0; }
+
+  bool BinarySerializer::HasPlan(NGIN::UInt64 typeId) const noexcept
+  {
+    return m_state && m_state->plans.Find(typeId) != nullptr;
+  }
+
+  void BinarySerializer::Clear() noexcept
+  {
+    if (m_state)
+      m_state->plans.Clear();
+  }
+
+  // Called inside a PlanCache scope (see WriteObject/ReadObject).
+  std::expected<NGIN::UInt32, Error> BinarySerializer::PlanFor(NGIN::UInt64 typeId)
+  {
+    auto &s = *m_state;
+    return s.plans.Get(typeId,
+                       [&]
+                       {
+                         [[maybe_unused]] auto lock = detail::LockRegistryRead();
+                         return s.Compile(detail::GetRegistry(), typeId);
+                       });
+  }
+
+  std::expected<void, Error> BinarySerializer::RunWrite(NGIN::UInt32 plan, const void *obj, BinaryWriter &out)
+  {
+    // Codecs may compile further plans and grow the table, so copy each step out.
+    for (NGIN::UIntSize i = 0; i < m_state->plans[plan].steps.Size(); ++i)
+    {
+      const Step step = m_state->plans[plan].steps[i];
+      const auto *member = step.at.In(obj);
+      switch (step.kind)
+      {
+      case StepKind::Span:
+        out.Write(member, step.size);
+        break;
+      case StepKind::Codec:
+        if (auto r = step.write(member, *this, out); !r.has_value())
+          return r;
+        break;
+      case StepKind::Nested:
+        if (auto r = RunWrite(step.nested, member, out); !r.has_value())
+          return r;
+        break;
+      }
+    }
+    return {};
+  }
+
+  std::expected<void, Error> BinarySerializer::RunRead(NGIN::UInt32 plan, void *obj, BinaryReader &in)
+  {
+    for (NGIN::UIntSize i = 0; i < m_state->plans[plan].steps.Size(); ++i)
+    {
+      const Step step = m_state->plans[plan].steps[i];
+      auto *member = step.at.In(obj);
+      switch (step.kind)
+      {
+      case StepKind::Span:
+        if (!in.Read(member, step.size))
+          return std::unexpected(detail::TruncatedInput());
+        break;
+      case StepKind::Codec:
+        if (auto r = step.read(member, *this, in); !r.has_value())
+          return r;
+        break;
+      case StepKind::Nested:
+        if (auto r = RunRead(step.nested, member, in); !r.has_value())
+          return r;
+        break;
+      }
+    }
+    return {};
+  }
+
+  std::expected<void, Error> BinarySerializer::WriteObject(NGIN::UInt64 typeId, const void *obj, BinaryWriter &out)
+  {
+    if (!m_state)
+      m_state = std::make_unique<State>();
+    // Element codecs re-enter here; only the outermost call may drop stale plans.
+    auto scope = m_state->plans.Enter();
+    auto plan = PlanFor(typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    return RunWrite(*plan, obj, out);
+  }
+
+  std::expected<void, Error> BinarySerializer::ReadObject(NGIN::UInt64 typeId, void *obj, BinaryReader &in)
+  {
+    if (!m_state)
+      m_state = std::make_unique<State>();
+    auto scope = m_state->plans.Enter();
+    auto plan = PlanFor(typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    return RunRead(*plan, obj, in);
+  }
+
+  std::expected<void, Error> BinarySerializer::Write(Type type, const void *obj, BinaryWriter &out)
+  {
+    if (!type.IsValid())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    return WriteObject(type.GetTypeId(), obj, out);
+  }
+
+  std::expected<void, Error> BinarySerializer::Read(Type type, void *obj, BinaryReader &in)
+  {
+    if (!type.IsValid())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    return ReadObject(type.GetTypeId(), obj, in);
+  }
+
+  std::expected<NGIN::UIntSize, Error> BinarySerializer::Write(Type type, const void *obj, std::span<std::byte> buffer)
+  {
+    BinaryWriter out{buffer};
+    if (auto r = Write(type, obj, out); !r.has_value())
+      return std::unexpected(std::move(r.error()));
+    if (out.Overflowed())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "buffer too small"});
+    return out.Written();
+  }
+
+  std::expected<NGIN::UIntSize, Error> BinarySerializer::Read(Type type, void *obj, std::span<const std::byte> buffer)
+  {
+    BinaryReader in{buffer};
+    if (auto r = Read(type, obj, in); !r.has_value())
+      return std::unexpected(std::move(r.error()));
+    return in.Consumed();
+  }
+} // namespace NGIN::Reflection
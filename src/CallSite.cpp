@@ -0,0 +1,65 @@
+#include <NGIN/Reflection/CallSite.hpp>
+
+namespace NGIN::Reflection
+{
+
+  std::expected<Any, Error> CallSite::InvokeSlow(const Type &receiver, void *obj, const Any *args, NGIN::UIntSize count)
+  {
+    ++m_misses;
+    // Read the epoch before resolving: if the registry changes while we resolve, the new
+    // entry is tagged with the old epoch and dropped on the next call.
+    const auto epoch = detail::RegistryEpoch();
+    if (epoch != m_epoch)
+    {
+      m_size = 0;
+      m_next = 0;
+      m_epoch = epoch;
+    }
+
+    auto resolved = receiver.ResolveMethod(m_name, args, count);
+    if (!resolved.has_value())
+      return std::unexpected(std::move(resolved.error()));
+
+    if (count <= MaxArgs)
+    {
+      [[maybe_unused]] auto lock = detail::LockRegistryRead();
+      const auto &reg = detail::GetRegistry();
+      if (detail::IsMethodAlive(reg, resolved->m_typeIndex, resolved->m_typeGeneration, resolved->m_methodIndex))
+      {
+        const auto &m = reg.types[resolved->m_typeIndex].methods[resolved->m_methodIndex];
+        const auto &plan = resolved->m_plan;
+        Entry entry{};
+        entry.typeIndex = resolved->m_typeIndex;
+        entry.typeGeneration = resolved->m_typeGeneration;
+        entry.argCount = static_cast<NGIN::UInt32>(count);
+        for (NGIN::UIntSize i = 0; i < count; ++i)
+        {
+          entry.argTypeIds[i] = plan.TypeIds()[i];
+          entry.converters[i] = plan.Converters()[i];
+          if (detail::ArgIsMutableView(args[i]))
+            entry.mutableViewMask |= 1u << i;
+        }
+        if (!plan.NeedsConversion())
+          entry.thunk = m.InvokeExact ? m.InvokeExact : m.Invoke;
+        else if (plan.HasAllConverters() && m.InvokeConverted)
+          entry.convertedThunk = m.InvokeConverted;
+        else
+          entry.thunk = m.Invoke;
+        if (entry.thunk || entry.convertedThunk)
+        {
+          if (m_size < Capacity)
+          {
+            m_entries[m_size++] = entry;
+          }
+          else
+          {
+            m_entries[m_next] = entry;
+            m_next = static_cast<NGIN::UInt32>((m_next + 1) % Capacity);
+          }
+        }
+      }
+    }
+    return resolved->Invoke(obj, args, count);
+  }
+
+} // namespace NGIN::Reflection
@@ -0,0 +1,112 @@
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <shared_mutex>
+
+namespace NGIN::Reflection::detail
+{
+  namespace
+  {
+    struct CachedPath
+    {
+      NGIN::UInt64 from{0};
+      NGIN::UInt64 to{0};
+      ArgConverter convert{nullptr}; // nullptr = no conversion between the pair
+      int cost{0};
+    };
+
+    // Lookups run under the shared registry lock, so the memo has its own lock.
+    std::shared_mutex g_pathMutex;
+    NGIN::Containers::FlatHashMap<NGIN::UInt64, CachedPath> g_paths;
+
+    inline NGIN::UInt64 PairKey(NGIN::UInt64 from, NGIN::UInt64 to) noexcept
+    {
+      return SignatureHashStep(SignatureHashStep(0, from), to);
+    }
+
+    void FlushPaths() noexcept
+    {
+      std::unique_lock lock{g_pathMutex};
+      g_paths.Clear();
+    }
+
+    void RebuildSources(Registry &reg)
+    {
+      reg.conversionSources.Clear();
+      for (NGIN::UIntSize i = 0; i < reg.conversions.Size(); ++i)
+      {
+        const auto from = reg.conversions[i].from;
+        if (auto *n = reg.conversionSources.GetPtr(from))
+          ++*n;
+        else
+          reg.conversionSources.Insert(from, 1u);
+      }
+    }
+  } // namespace
+
+  void RegisterConversion(const ConversionEdge &edge)
+  {
+    auto &reg = GetRegistry();
+    reg.conversions.PushBack(edge);
+    if (auto *n = reg.conversionSources.GetPtr(edge.from))
+      ++*n;
+    else
+      reg.conversionSources.Insert(edge.from, 1u);
+    FlushPaths();
+    BumpRegistryEpoch();
+  }
+
+  void RemoveModuleConversions(ModuleId moduleId)
+  {
+    auto &reg = GetRegistry();
+    bool removed = false;
+    for (NGIN::UIntSize i = 0; i < reg.conversions.Size();)
+    {
+      if (reg.conversions[i].moduleId == moduleId)
+      {
+        reg.conversions.Erase(i);
+        removed = true;
+      }
+      else
+        ++i;
+    }
+    if (!removed)
+      return;
+    RebuildSources(reg);
+    FlushPaths();
+  }
+
+  ArgConverter FindUserConversion(NGIN::UInt64 from, NGIN::UInt64 to, int &outCost) noexcept
+  {
+    const auto &reg = GetRegistry();
+    if (!reg.conversionSources.GetPtr(from))
+      return nullptr;
+    const auto key = PairKey(from, to);
+    {
+      std::shared_lock lock{g_pathMutex};
+      const auto *p = g_paths.GetPtr(key);
+      if (p && p->from == from && p->to == to)
+      {
+        outCost = p->cost;
+        return p->convert;
+      }
+    }
+
+    CachedPath path{from, to, nullptr, 0};
+    for (NGIN::UIntSize i = 0; i < reg.conversions.Size(); ++i)
+    {
+      const auto &e = reg.conversions[i];
+      if (e.from == from && e.to == to && (!path.convert || e.cost < path.cost))
+      {
+        path.convert = e.convert;
+        path.cost = e.cost;
+      }
+    }
+    {
+      std::unique_lock lock{g_pathMutex};
+      g_paths.Remove(key);
+      g_paths.Insert(key, path);
+    }
+    outCost = path.cost;
+    return path.convert;
+  }
+} // namespace NGIN::Reflection::detail
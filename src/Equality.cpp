@@ -0,0 +1,316 @@
+#include <NGIN/Reflection/Equality.hpp>
+#include <NGIN/Reflection/PlanCache.hpp>
+
+namespace NGIN::Reflection
+{
+  namespace
+  {
+    constexpr NGIN::UInt64 kHashSeed = 0x243F6A8885A308D3ull;
+    constexpr NGIN::UInt64 kLanePrime = 0x9E3779B185EBCA87ull;
+
+    constexpr NGIN::UInt64 Rotl(NGIN::UInt64 x, int r) noexcept
+    {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    // splitmix64 finalizer.
+    constexpr NGIN::UInt64 Mix(NGIN::UInt64 x) noexcept
+    {
+      x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+      x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+      return x ^ (x >> 31);
+    }
+
+    NGIN::UInt64 LoadWord(const unsigned char *p) noexcept
+    {
+      NGIN::UInt64 w;
+      std::memcpy(&w, p, sizeof(w));
+      return w;
+    }
+
+    enum class StepKind : NGIN::UInt8
+    {
+      Span,   // bytewise fields (possibly several adjacent ones), memcmp / HashBytes
+      Deep,   // strings and containers through the field's DeepEqual/DeepHash
+      Nested, // reflected member with its own plan
+    };
+
+    struct Step
+    {
+      StepKind kind{StepKind::Span};
+      detail::MemberAccess at{};
+      NGIN::UIntSize size{0};
+      std::expected<bool, Error> (*equal)(const void *, const void *){nullptr};
+      std::expected<NGIN::UInt64, Error> (*hash)(const void *, NGIN::UInt64){nullptr};
+      NGIN::UInt32 nested{0};
+    };
+
+    struct Plan
+    {
+      NGIN::Containers::Vector<Step> steps;
+      // Only offset-addressed spans; such a plan is inlined into its owners' plans.
+      bool spansOnly{true};
+    };
+
+    // Appends a span, merging it into the previous one when the two touch in memory.
+    void PushSpan(Plan &plan, const Step &span)
+    {
+      if (plan.steps.Size() > 0)
+      {
+        auto &prev = plan.steps[plan.steps.Size() - 1];
+        if (prev.kind == StepKind::Span && prev.at.Abuts(prev.size, span.at))
+        {
+          prev.size += span.size;
+          return;
+        }
+      }
+      plan.steps.PushBack(span);
+    }
+
+    struct EqualityCache
+    {
+      detail::PlanCache<Plan> plans;
+
+      // Caller holds the registry read lock.
+      std::expected<NGIN::UInt32, Error> Compile(const detail::Registry &reg, NGIN::UInt64 typeId)
+      {
+        return plans.Compile(reg, typeId, [&](const detail::TypeDescriptor &desc, Plan &plan) { return Build(reg, desc, plan); });
+      }
+
+      std::expected<void, Error> Build(const detail::Registry &reg, const detail::TypeDescriptor &desc, Plan &plan)
+      {
+        const auto &fields = desc.fields;
+        if (fields.Size() == 0 && !desc.enumInfo.isEnum)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "type has no fields"});
+
+        if (fields.Size() == 0)
+        {
+          // An enum compares as its underlying integer.
+          PushSpan(plan, Step{StepKind::Span, {}, desc.sizeBytes});
+        }
+        for (NGIN::UIntSize i = 0; i < fields.Size(); ++i)
+        {
+          const auto &f = fields[i];
+          Step step{};
+          step.at = detail::MemberAccess::Of(f);
+
+          if (f.triviallyCopyable && f.bytewise)
+          {
+            step.kind = StepKind::Span;
+            step.size = f.sizeBytes;
+            PushSpan(plan, step);
+            continue;
+          }
+          if (const auto codecs = detail::FieldCodecs::Of(f); codecs.deepEqual && codecs.deepHash)
+          {
+            step.kind = StepKind::Deep;
+            step.equal = codecs.deepEqual;
+            step.hash = codecs.deepHash;
+            plan.steps.PushBack(step);
+            continue;
+          }
+
+          const auto *nestedIndex = reg.byTypeId.GetPtr(f.typeId);
+          const bool reflected = nestedIndex && (reg.types[*nestedIndex].fields.Size() > 0 || reg.types[*nestedIndex].enumInfo.isEnum);
+          if (!reflected)
+          {
+            // Trivially copyable but opaque (e.g. a math type from another library): its bytes,
+            // padding included, are all we can compare.
+            if (!f.triviallyCopyable)
+              return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not comparable"});
+            step.kind = StepKind::Span;
+            step.size = f.sizeBytes;
+            PushSpan(plan, step);
+            continue;
+          }
+          auto nested = Compile(reg, f.typeId);
+          if (!nested.has_value())
+            return std::unexpected(std::move(nested.error()));
+          if (step.at.Direct() && plans[*nested].spansOnly)
+          {
+            // Inline the member's spans at its offset so runs merge across the nesting.
+            const auto &inner = plans[*nested].steps;
+            for (NGIN::UIntSize k = 0; k < inner.Size(); ++k)
+            {
+              Step span = inner[k];
+              span.at.offset += step.at.offset;
+              PushSpan(plan, span);
+            }
+            continue;
+          }
+          step.kind = StepKind::Nested;
+          step.nested = *nested;
+          plan.steps.PushBack(step);
+        }
+        for (NGIN::UIntSize i = 0; i < plan.steps.Size(); ++i)
+        {
+          if (plan.steps[i].kind != StepKind::Span || !plan.steps[i].at.Direct())
+            plan.spansOnly = false;
+        }
+        return {};
+      }
+
+      // Caller holds the registry read lock and a PlanCache scope; deep members of reflected
+      // element types re-enter through EqualObjects/HashObject.
+      std::expected<NGIN::UInt32, Error> PlanFor(const detail::Registry &reg, NGIN::UInt64 typeId)
+      {
+        return plans.Get(typeId, [&] { return Compile(reg, typeId); });
+      }
+
+      // Deep members may compile further plans and grow the table, so each step is copied out.
+      std::expected<bool, Error> Equal(NGIN::UInt32 plan, const void *a, const void *b)
+      {
+        for (NGIN::UIntSize i = 0; i < plans[plan].steps.Size(); ++i)
+        {
+          const Step step = plans[plan].steps[i];
+          const auto *pa = step.at.In(a);
+          const auto *pb = step.at.In(b);
+          switch (step.kind)
+          {
+          case StepKind::Span:
+            if (std::memcmp(pa, pb, step.size) != 0)
+              return false;
+            break;
+          case StepKind::Deep:
+          {
+            auto r = step.equal(pa, pb);
+            if (!r.has_value() || !*r)
+              return r;
+            break;
+          }
+          case StepKind::Nested:
+          {
+            auto r = Equal(step.nested, pa, pb);
+            if (!r.has_value() || !*r)
+              return r;
+            break;
+          }
+          }
+        }
+        return true;
+      }
+
+      std::expected<NGIN::UInt64, Error> Hash(NGIN::UInt32 plan, const void *obj, NGIN::UInt64 seed)
+      {
+        NGIN::UInt64 h = seed;
+        for (NGIN::UIntSize i = 0; i < plans[plan].steps.Size(); ++i)
+        {
+          const Step step = plans[plan].steps[i];
+          const auto *p = step.at.In(obj);
+          switch (step.kind)
+          {
+          case StepKind::Span:
+            h = detail::HashBytes(p, step.size, h);
+            break;
+          case StepKind::Deep:
+          {
+            auto r = step.hash(p, h);
+            if (!r.has_value())
+              return r;
+            h = *r;
+            break;
+          }
+          case StepKind::Nested:
+          {
+            auto r = Hash(step.nested, p, h);
+            if (!r.has_value())
+              return r;
+            h = *r;
+            break;
+          }
+          }
+        }
+        return h;
+      }
+    };
+
+    thread_local EqualityCache t_equalityCache;
+  } // namespace
+
+  namespace detail
+  {
+    NGIN::UInt64 HashBytes(const void *data, NGIN::UIntSize size, NGIN::UInt64 seed) noexcept
+    {
+      const auto *p = static_cast<const unsigned char *>(data);
+      NGIN::UInt64 h = seed ^ (static_cast<NGIN::UInt64>(size) * kLanePrime);
+      if (size >= 32)
+      {
+        // Independent lanes keep four multiplies in flight per block.
+        NGIN::UInt64 lanes[4] = {h, h ^ 0x1ull, h ^ 0x2ull, h ^ 0x3ull};
+        while (size >= 32)
+        {
+          for (int k = 0; k < 4; ++k)
+            lanes[k] = Rotl(lanes[k] ^ (LoadWord(p + k * 8) * kLanePrime), 31) * kLanePrime;
+          p += 32;
+          size -= 32;
+        }
+        h = Mix(lanes[0]) ^ Rotl(Mix(lanes[1]), 16) ^ Rotl(Mix(lanes[2]), 32) ^ Rotl(Mix(lanes[3]), 48);
+      }
+      while (size >= 8)
+      {
+        h = Mix(h ^ LoadWord(p));
+        p += 8;
+        size -= 8;
+      }
+      if (size > 0)
+      {
+        NGIN::UInt64 tail = 0;
+        std::memcpy(&tail, p, size);
+        h = Mix(h ^ tail ^ (static_cast<NGIN::UInt64>(size) << 56));
+      }
+      return Mix(h);
+    }
+
+    std::expected<bool, Error> EqualObjects(NGIN::UInt64 typeId, const void *a, const void *b)
+    {
+      [[maybe_unused]] auto lock = LockRegistryRead();
+      auto &cache = t_equalityCache;
+      auto scope = cache.plans.Enter();
+      auto plan = cache.PlanFor(GetRegistry(), typeId);
+      if (!plan.has_value())
+        return std::unexpected(std::move(plan.error()));
+      return cache.Equal(*plan, a, b);
+    }
+
+    std::expected<NGIN::UInt64, Error> HashObject(NGIN::UInt64 typeId, const void *obj, NGIN::UInt64 seed)
+    {
+      [[maybe_unused]] auto lock = LockRegistryRead();
+      auto &cache = t_equalityCache;
+      auto scope = cache.plans.Enter();
+      auto plan = cache.PlanFor(GetRegistry(), typeId);
+      if (!plan.has_value())
+        return std::unexpected(std::move(plan.error()));
+      return cache.Hash(*plan, obj, seed);
+    }
+  } // namespace detail
+
+  std::expected<bool, Error> Type::Equals(const void *a, const void *b) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    auto &cache = t_equalityCache;
+    auto scope = cache.plans.Enter();
+    auto plan = cache.PlanFor(reg, reg.types[m_h.index].typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    if (a == b)
+      return true;
+    return cache.Equal(*plan, a, b);
+  }
+
+  std::expected<NGIN::UInt64, Error> Type::Hash(const void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    auto &cache = t_equalityCache;
+    auto scope = cache.plans.Enter();
+    auto plan = cache.PlanFor(reg, reg.types[m_h.index].typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    return cache.Hash(*plan, obj, kHashSeed);
+  }
+} // namespace NGIN::Reflection
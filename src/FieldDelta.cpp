@@ -0,0 +1,358 @@
+#include <NGIN/Reflection/FieldDelta.hpp>
+#include <NGIN/Reflection/BinarySerializer.hpp>
+#include <NGIN/Reflection/PlanCache.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace NGIN::Reflection
+{
+  namespace
+  {
+    enum class StepKind : NGIN::UInt8
+    {
+      Run,    // adjacent trivially copyable fields, compared with one memcmp
+      Codec,  // strings/containers: DeepEqual, then the binary codec
+      Nested, // reflected member with its own plan
+    };
+
+    struct Step
+    {
+      StepKind kind{StepKind::Run};
+      // Run: fields [firstField, firstField + fieldCount); otherwise the one field.
+      NGIN::UInt32 firstField{0};
+      NGIN::UInt32 fieldCount{1};
+      detail::MemberAccess at{};
+      NGIN::UIntSize size{0};
+      std::expected<bool, Error> (*equal)(const void *, const void *){nullptr};
+      std::expected<void, Error> (*write)(const void *, BinarySerializer &, BinaryWriter &){nullptr};
+      std::expected<void, Error> (*read)(void *, BinarySerializer &, BinaryReader &){nullptr};
+      NGIN::UInt32 nested{0};
+    };
+
+    struct Plan
+    {
+      NGIN::UInt32 fieldCount{0};
+      NGIN::Containers::Vector<Step> steps;
+      // Byte size of every field, indexed by field; splits a run that differs.
+      NGIN::Containers::Vector<NGIN::UIntSize> fieldSizes;
+    };
+
+    constexpr NGIN::UIntSize MaskWords(NGIN::UIntSize fieldCount) noexcept
+    {
+      return (fieldCount + 63) / 64;
+    }
+
+    // Mask being written: the top-level words of a FieldPatch, or nested words stored inline
+    // in the payload (addressed by position, since the payload grows while diffing).
+    struct MaskSink
+    {
+      NGIN::UInt64 *words{nullptr};
+      std::vector<std::byte> *bytes{nullptr};
+      NGIN::UIntSize pos{0};
+
+      void Set(NGIN::UIntSize bit) noexcept
+      {
+        const auto bitMask = NGIN::UInt64{1} << (bit % 64);
+        if (words)
+        {
+          words[bit / 64] |= bitMask;
+          return;
+        }
+        auto *p = bytes->data() + pos + (bit / 64) * sizeof(NGIN::UInt64);
+        NGIN::UInt64 w;
+        std::memcpy(&w, p, sizeof(w));
+        w |= bitMask;
+        std::memcpy(p, &w, sizeof(w));
+      }
+    };
+
+    // Mask being read; the words may be unaligned inside the payload.
+    struct MaskView
+    {
+      const std::byte *words{nullptr};
+
+      [[nodiscard]] bool Test(NGIN::UIntSize bit) const noexcept
+      {
+        NGIN::UInt64 w;
+        std::memcpy(&w, words + (bit / 64) * sizeof(NGIN::UInt64), sizeof(w));
+        return ((w >> (bit % 64)) & 1) != 0;
+      }
+
+      // No bits set past the last field.
+      [[nodiscard]] bool Fits(NGIN::UIntSize fieldCount) const noexcept
+      {
+        if (fieldCount % 64 == 0)
+          return true;
+        NGIN::UInt64 w;
+        std::memcpy(&w, words + (fieldCount / 64) * sizeof(NGIN::UInt64), sizeof(w));
+        return (w >> (fieldCount % 64)) == 0;
+      }
+    };
+
+    Error MalformedPatch() noexcept
+    {
+      return Error{ErrorCode::InvalidArgument, "patch does not match type"};
+    }
+
+    struct DeltaCache
+    {
+      detail::PlanCache<Plan> plans;
+      BinarySerializer codec;
+
+      // Caller holds the registry read lock.
+      std::expected<NGIN::UInt32, Error> Compile(const detail::Registry &reg, NGIN::UInt64 typeId)
+      {
+        return plans.Compile(reg, typeId, [&](const detail::TypeDescriptor &desc, Plan &plan) { return Build(reg, desc, plan); });
+      }
+
+      std::expected<void, Error> Build(const detail::Registry &reg, const detail::TypeDescriptor &desc, Plan &plan)
+      {
+        const auto &fields = desc.fields;
+        if (fields.Size() == 0)
+          return std::unexpected(Error{ErrorCode::InvalidArgument, "type has no fields"});
+
+        plan.fieldCount = static_cast<NGIN::UInt32>(fields.Size());
+        for (NGIN::UIntSize i = 0; i < fields.Size(); ++i)
+        {
+          const auto &f = fields[i];
+          plan.fieldSizes.PushBack(f.sizeBytes);
+          Step step{};
+          step.firstField = static_cast<NGIN::UInt32>(i);
+          step.at = detail::MemberAccess::Of(f);
+
+          if (f.triviallyCopyable)
+          {
+            step.kind = StepKind::Run;
+            step.size = f.sizeBytes;
+            // Extend the previous run when the two fields touch in memory.
+            if (plan.steps.Size() > 0)
+            {
+              auto &prev = plan.steps[plan.steps.Size() - 1];
+              if (prev.kind == StepKind::Run && prev.at.Abuts(prev.size, step.at))
+              {
+                prev.size += step.size;
+                ++prev.fieldCount;
+                continue;
+              }
+            }
+          }
+          else if (const auto codecs = detail::FieldCodecs::Of(f); codecs.writeBinary && codecs.readBinary && codecs.deepEqual)
+          {
+            step.kind = StepKind::Codec;
+            step.equal = codecs.deepEqual;
+            step.write = codecs.writeBinary;
+            step.read = codecs.readBinary;
+          }
+          else
+          {
+            auto nested = Compile(reg, f.typeId);
+            if (!nested.has_value())
+              return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not diffable"});
+            step.kind = StepKind::Nested;
+            step.nested = *nested;
+          }
+          plan.steps.PushBack(step);
+        }
+        return {};
+      }
+
+      // Caller holds the registry read lock and a PlanCache scope.
+      std::expected<NGIN::UInt32, Error> PlanFor(const detail::Registry &reg, NGIN::UInt64 typeId)
+      {
+        return plans.Get(typeId, [&] { return Compile(reg, typeId); });
+      }
+
+      // Appends the codec encoding of `member` to `out`.
+      std::expected<void, Error> Encode(const Step &step, const void *member, std::vector<std::byte> &out)
+      {
+        const auto base = out.size();
+        auto room = std::max<NGIN::UIntSize>(out.capacity() - base, 64);
+        for (;;)
+        {
+          out.resize(base + room);
+          BinaryWriter w{std::span<std::byte>{out.data() + base, room}};
+          if (auto r = step.write(member, codec, w); !r.has_value())
+          {
+            out.resize(base);
+            return r;
+          }
+          if (!w.Overflowed())
+          {
+            out.resize(base + w.Written());
+            return {};
+          }
+          room = w.Required();
+        }
+      }
+
+      std::expected<bool, Error> Diff(NGIN::UInt32 planIndex, const void *a, const void *b, MaskSink mask, std::vector<std::byte> &payload)
+      {
+        // Codecs run through their own serializer and never compile into this cache, so the
+        // reference stays valid while diffing.
+        const auto &plan = plans[planIndex];
+        bool changed = false;
+        for (NGIN::UIntSize s = 0; s < plan.steps.Size(); ++s)
+        {
+          const auto &step = plan.steps[s];
+          const auto *pa = step.at.In(a);
+          const auto *pb = step.at.In(b);
+          switch (step.kind)
+          {
+          case StepKind::Run:
+          {
+            if (std::memcmp(pa, pb, step.size) == 0)
+              break;
+            NGIN::UIntSize off = 0;
+            for (NGIN::UInt32 j = step.firstField; j < step.firstField + step.fieldCount; ++j)
+            {
+              const auto size = plan.fieldSizes[j];
+              if (std::memcmp(pa + off, pb + off, size) != 0)
+              {
+                mask.Set(j);
+                const auto *src = reinterpret_cast<const std::byte *>(pb + off);
+                payload.insert(payload.end(), src, src + size);
+                changed = true;
+              }
+              off += size;
+            }
+            break;
+          }
+          case StepKind::Codec:
+          {
+            auto same = step.equal(pa, pb);
+            if (!same.has_value())
+              return same;
+            if (*same)
+              break;
+            mask.Set(step.firstField);
+            if (auto r = Encode(step, pb, payload); !r.has_value())
+              return std::unexpected(std::move(r.error()));
+            changed = true;
+            break;
+          }
+          case StepKind::Nested:
+          {
+            const auto pos = payload.size();
+            payload.resize(pos + MaskWords(plans[step.nested].fieldCount) * sizeof(NGIN::UInt64));
+            auto nested = Diff(step.nested, pa, pb, MaskSink{nullptr, &payload, pos}, payload);
+            if (!nested.has_value())
+              return nested;
+            if (!*nested)
+            {
+              payload.resize(pos);
+              break;
+            }
+            mask.Set(step.firstField);
+            changed = true;
+            break;
+          }
+          }
+        }
+        return changed;
+      }
+
+      std::expected<void, Error> Apply(NGIN::UInt32 planIndex, void *obj, MaskView mask, const std::byte *payload, BinaryReader &in)
+      {
+        const auto &plan = plans[planIndex];
+        if (!mask.Fits(plan.fieldCount))
+          return std::unexpected(MalformedPatch());
+        for (NGIN::UIntSize s = 0; s < plan.steps.Size(); ++s)
+        {
+          const auto &step = plan.steps[s];
+          switch (step.kind)
+          {
+          case StepKind::Run:
+          {
+            auto *p = step.at.In(obj);
+            NGIN::UIntSize off = 0;
+            for (NGIN::UInt32 j = step.firstField; j < step.firstField + step.fieldCount; ++j)
+            {
+              const auto size = plan.fieldSizes[j];
+              if (mask.Test(j) && !in.Read(p + off, size))
+                return std::unexpected(MalformedPatch());
+              off += size;
+            }
+            break;
+          }
+          case StepKind::Codec:
+            if (!mask.Test(step.firstField))
+              break;
+            if (auto r = step.read(step.at.In(obj), codec, in); !r.has_value())
+              return r;
+            break;
+          case StepKind::Nested:
+          {
+            if (!mask.Test(step.firstField))
+              break;
+            const MaskView nestedMask{payload + in.Consumed()};
+            const auto words = MaskWords(plans[step.nested].fieldCount);
+            for (NGIN::UIntSize w = 0; w < words; ++w)
+            {
+              NGIN::UInt64 skipped;
+              if (!in.Read(&skipped, sizeof(skipped)))
+                return std::unexpected(MalformedPatch());
+            }
+            if (auto r = Apply(step.nested, step.at.In(obj), nestedMask, payload, in); !r.has_value())
+              return r;
+            break;
+          }
+          }
+        }
+        return {};
+      }
+    };
+
+    thread_local DeltaCache t_deltaCache;
+  } // namespace
+
+  std::expected<bool, Error> Type::Diff(const void *from, const void *to, FieldPatch &out) const
+  {
+    out.Clear();
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    auto &cache = t_deltaCache;
+    auto scope = cache.plans.Enter();
+    auto plan = cache.PlanFor(reg, reg.types[m_h.index].typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    out.mask.assign(MaskWords(cache.plans[*plan].fieldCount), 0);
+    auto changed = cache.Diff(*plan, from, to, MaskSink{out.mask.data(), nullptr, 0}, out.payload);
+    if (!changed.has_value())
+      out.Clear();
+    return changed;
+  }
+
+  std::expected<FieldPatch, Error> Type::Diff(const void *from, const void *to) const
+  {
+    FieldPatch patch;
+    if (auto r = Diff(from, to, patch); !r.has_value())
+      return std::unexpected(std::move(r.error()));
+    return patch;
+  }
+
+  std::expected<void, Error> Type::ApplyPatch(void *obj, const FieldPatch &patch) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    auto &cache = t_deltaCache;
+    auto scope = cache.plans.Enter();
+    auto plan = cache.PlanFor(reg, reg.types[m_h.index].typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    if (patch.mask.size() != MaskWords(cache.plans[*plan].fieldCount))
+      return std::unexpected(MalformedPatch());
+
+    BinaryReader in{std::span<const std::byte>{patch.payload.data(), patch.payload.size()}};
+    const MaskView mask{reinterpret_cast<const std::byte *>(patch.mask.data())};
+    if (auto r = cache.Apply(*plan, obj, mask, patch.payload.data(), in); !r.has_value())
+      return r;
+    if (in.Remaining() != 0)
+      return std::unexpected(MalformedPatch());
+    return {};
+  }
+} // namespace NGIN::Reflection
@@ -0,0 +1,95 @@
+#include <NGIN/Reflection/FieldPath.hpp>
+
+#include <cstring>
+
+namespace NGIN::Reflection
+{
+  Any FieldPath::GetAny(const void *root) const
+  {
+    if (!m_load)
+      return Any::MakeVoid();
+    return m_load(OwnerOf(const_cast<void *>(root)));
+  }
+
+  std::expected<void, Error> FieldPath::SetAny(void *root, const Any &value) const
+  {
+    if (!IsValid())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "invalid field path"});
+    if (m_store)
+      return m_store(OwnerOf(root), value);
+    if (value.GetTypeId() != m_typeId)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "type-id mismatch"});
+    if (value.Size() != m_size)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "size mismatch"});
+    std::memcpy(Resolve(root), value.Data(), m_size);
+    return {};
+  }
+
+  std::expected<FieldPath, Error> Type::CompilePath(std::string_view path) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+
+    FieldPath out;
+    out.m_rootTypeId = reg.types[m_h.index].typeId;
+    NGIN::UInt32 typeIndex = m_h.index;
+    // Offsets of consecutive offset hops are summed; a getter hop flushes the sum first.
+    NGIN::UIntSize pending = 0;
+    bool collapsible = true;
+    while (true)
+    {
+      const auto dot = path.find('.');
+      const auto segment = path.substr(0, dot);
+      if (segment.empty())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "empty path segment"});
+
+      const auto &tdesc = reg.types[typeIndex];
+      NameId nid{};
+      (void)detail::FindNameId(segment, nid);
+      const auto *fieldIndex = tdesc.fieldIndex.GetPtr(nid);
+      if (!fieldIndex)
+        return std::unexpected(Error{ErrorCode::NotFound, "field not found"});
+      const auto &f = tdesc.fields[*fieldIndex];
+      // Fields merged from an ABI blob may carry neither; the member cannot be located.
+      if (f.offset == detail::kNoFieldOffset && !f.GetMut)
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "field has no offset or accessor"});
+      ++out.m_depth;
+
+      if (dot == std::string_view::npos)
+      {
+        out.m_leafOffset = f.offset;
+        out.m_leafGet = f.GetMut;
+        out.m_load = f.Load;
+        out.m_store = f.Store;
+        out.m_typeId = f.typeId;
+        out.m_size = f.sizeBytes;
+        if (collapsible && f.offset != detail::kNoFieldOffset)
+          out.m_offset = pending + f.offset;
+        // Kept even when the path collapsed: Load/Store take the leaf's owner, not the root.
+        if (pending != 0)
+          out.m_hops.PushBack(FieldPath::Hop{pending, nullptr});
+        return out;
+      }
+
+      const auto *next = reg.byTypeId.GetPtr(f.typeId);
+      if (!next)
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "path goes through a non-reflected member"});
+      if (f.offset != detail::kNoFieldOffset)
+      {
+        pending += f.offset;
+      }
+      else
+      {
+        if (pending != 0)
+          out.m_hops.PushBack(FieldPath::Hop{pending, nullptr});
+        out.m_hops.PushBack(FieldPath::Hop{0, f.GetMut});
+        pending = 0;
+        collapsible = false;
+      }
+      typeIndex = *next;
+      path.remove_prefix(dot + 1);
+    }
+  }
+} // namespace NGIN::Reflection
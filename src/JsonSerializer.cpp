@@ -0,0 +1,854 @@
+#include <NGIN/Reflection/JsonSerializer.hpp>
+#include <NGIN/Reflection/PlanCache.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace NGIN::Reflection
+{
+  namespace
+  {
+    constexpr NGIN::UInt32 kNoKey = static_cast<NGIN::UInt32>(-1);
+
+    bool ReadHex4(std::string_view text, NGIN::UIntSize &pos, NGIN::UInt32 &out) noexcept
+    {
+      if (text.size() - pos < 4)
+        return false;
+      out = 0;
+      for (int i = 0; i < 4; ++i)
+      {
+        const char c = text[pos++];
+        out <<= 4;
+        if (c >= '0' && c <= '9')
+          out |= static_cast<NGIN::UInt32>(c - '0');
+        else if (c >= 'a' && c <= 'f')
+          out |= static_cast<NGIN::UInt32>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+          out |= static_cast<NGIN::UInt32>(c - 'A' + 10);
+        else
+          return false;
+      }
+      return true;
+    }
+
+    void AppendUtf8(std::string &out, NGIN::UInt32 cp)
+    {
+      if (cp < 0x80)
+      {
+        out.push_back(static_cast<char>(cp));
+      }
+      else if (cp < 0x800)
+      {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+      else if (cp < 0x10000)
+      {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+      else
+      {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+    }
+
+    NGIN::UInt64 KeyHash(std::string_view key, NGIN::UInt64 seed) noexcept
+    {
+      NGIN::UInt64 h = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+      for (const char c : key)
+      {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+      }
+      return h ^ (h >> 32);
+    }
+
+    // Perfect hash over a fixed key set: every key owns its own slot, so a lookup is one hash
+    // and one string compare. Built once per plan by searching for a seed without collisions.
+    struct KeyTable
+    {
+      NGIN::Containers::Vector<std::string> keys;
+      NGIN::Containers::Vector<NGIN::UInt32> slots; // key index + 1; 0 = empty
+      NGIN::UInt64 seed{0};
+      NGIN::UInt64 mask{0};
+
+      // False when `key` is already present.
+      bool Add(std::string_view key)
+      {
+        for (NGIN::UIntSize i = 0; i < keys.Size(); ++i)
+        {
+          if (keys[i] == key)
+            return false;
+        }
+        keys.PushBack(std::string{key});
+        return true;
+      }
+
+      void Build()
+      {
+        NGIN::UIntSize size = 1;
+        while (size < keys.Size() * 2)
+          size <<= 1;
+        for (;; size <<= 1)
+        {
+          slots.Clear();
+          for (NGIN::UIntSize i = 0; i < size; ++i)
+            slots.PushBack(0);
+          for (NGIN::UInt64 s = 0; s < 64; ++s)
+          {
+            bool ok = true;
+            for (NGIN::UIntSize i = 0; i < keys.Size() && ok; ++i)
+            {
+              auto &slot = slots[KeyHash(keys[i], s) & (size - 1)];
+              if (slot != 0)
+                ok = false;
+              else
+                slot = static_cast<NGIN::UInt32>(i + 1);
+            }
+            if (ok)
+            {
+              seed = s;
+              mask = size - 1;
+              return;
+            }
+            for (NGIN::UIntSize i = 0; i < size; ++i)
+              slots[i] = 0;
+          }
+        }
+      }
+
+      NGIN::UInt32 Find(std::string_view key) const noexcept
+      {
+        const auto slot = slots[KeyHash(key, seed) & mask];
+        if (slot == 0 || keys[slot - 1] != key)
+          return kNoKey;
+        return slot - 1;
+      }
+    };
+
+    // Fields the plan reads and writes itself, resolved from the field's type id, so they need
+    // no codec generated at registration.
+    enum class Scalar : NGIN::UInt8
+    {
+      None,
+      Bool,
+      SChar,
+      UChar,
+      Char,
+      Short,
+      UShort,
+      Int,
+      UInt,
+      Long,
+      ULong,
+      LongLong,
+      ULongLong,
+      Float,
+      Double,
+      LongDouble,
+      String,
+    };
+
+    Scalar ScalarOf(NGIN::UInt64 tid) noexcept
+    {
+      using detail::TypeIdOf;
+      if (tid == TypeIdOf<bool>())
+        return Scalar::Bool;
+      if (tid == TypeIdOf<signed char>())
+        return Scalar::SChar;
+      if (tid == TypeIdOf<unsigned char>())
+        return Scalar::UChar;
+      if (tid == TypeIdOf<char>())
+        return Scalar::Char;
+      if (tid == TypeIdOf<short>())
+        return Scalar::Short;
+      if (tid == TypeIdOf<unsigned short>())
+        return Scalar::UShort;
+      if (tid == TypeIdOf<int>())
+        return Scalar::Int;
+      if (tid == TypeIdOf<unsigned int>())
+        return Scalar::UInt;
+      if (tid == TypeIdOf<long>())
+        return Scalar::Long;
+      if (tid == TypeIdOf<unsigned long>())
+        return Scalar::ULong;
+      if (tid == TypeIdOf<long long>())
+        return Scalar::LongLong;
+      if (tid == TypeIdOf<unsigned long long>())
+        return Scalar::ULongLong;
+      if (tid == TypeIdOf<float>())
+        return Scalar::Float;
+      if (tid == TypeIdOf<double>())
+        return Scalar::Double;
+      if (tid == TypeIdOf<long double>())
+        return Scalar::LongDouble;
+      if (tid == TypeIdOf<std::string>())
+        return Scalar::String;
+      return Scalar::None;
+    }
+
+    std::expected<void, Error> WriteScalar(Scalar kind, const void *p, JsonSerializer &s, JsonWriter &w)
+    {
+      using detail::EncodeJson;
+      switch (kind)
+      {
+      case Scalar::Bool:
+        return EncodeJson(*static_cast<const bool *>(p), s, w);
+      case Scalar::SChar:
+        return EncodeJson(*static_cast<const signed char *>(p), s, w);
+      case Scalar::UChar:
+        return EncodeJson(*static_cast<const unsigned char *>(p), s, w);
+      case Scalar::Char:
+        return EncodeJson(*static_cast<const char *>(p), s, w);
+      case Scalar::Short:
+        return EncodeJson(*static_cast<const short *>(p), s, w);
+      case Scalar::UShort:
+        return EncodeJson(*static_cast<const unsigned short *>(p), s, w);
+      case Scalar::Int:
+        return EncodeJson(*static_cast<const int *>(p), s, w);
+      case Scalar::UInt:
+        return EncodeJson(*static_cast<const unsigned int *>(p), s, w);
+      case Scalar::Long:
+        return EncodeJson(*static_cast<const long *>(p), s, w);
+      case Scalar::ULong:
+        return EncodeJson(*static_cast<const unsigned long *>(p), s, w);
+      case Scalar::LongLong:
+        return EncodeJson(*static_cast<const long long *>(p), s, w);
+      case Scalar::ULongLong:
+        return EncodeJson(*static_cast<const unsigned long long *>(p), s, w);
+      case Scalar::Float:
+        return EncodeJson(*static_cast<const float *>(p), s, w);
+      case Scalar::Double:
+        return EncodeJson(*static_cast<const double *>(p), s, w);
+      case Scalar::LongDouble:
+        return EncodeJson(*static_cast<const long double *>(p), s, w);
+      case Scalar::String:
+        return EncodeJson(*static_cast<const std::string *>(p), s, w);
+      case Scalar::None:
+        break;
+      }
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+    }
+
+    std::expected<void, Error> ReadScalar(Scalar kind, void *p, JsonSerializer &s, JsonReader &r)
+    {
+      using detail::DecodeJson;
+      switch (kind)
+      {
+      case Scalar::Bool:
+        return DecodeJson(*static_cast<bool *>(p), s, r);
+      case Scalar::SChar:
+        return DecodeJson(*static_cast<signed char *>(p), s, r);
+      case Scalar::UChar:
+        return DecodeJson(*static_cast<unsigned char *>(p), s, r);
+      case Scalar::Char:
+        return DecodeJson(*static_cast<char *>(p), s, r);
+      case Scalar::Short:
+        return DecodeJson(*static_cast<short *>(p), s, r);
+      case Scalar::UShort:
+        return DecodeJson(*static_cast<unsigned short *>(p), s, r);
+      case Scalar::Int:
+        return DecodeJson(*static_cast<int *>(p), s, r);
+      case Scalar::UInt:
+        return DecodeJson(*static_cast<unsigned int *>(p), s, r);
+      case Scalar::Long:
+        return DecodeJson(*static_cast<long *>(p), s, r);
+      case Scalar::ULong:
+        return DecodeJson(*static_cast<unsigned long *>(p), s, r);
+      case Scalar::LongLong:
+        return DecodeJson(*static_cast<long long *>(p), s, r);
+      case Scalar::ULongLong:
+        return DecodeJson(*static_cast<unsigned long long *>(p), s, r);
+      case Scalar::Float:
+        return DecodeJson(*static_cast<float *>(p), s, r);
+      case Scalar::Double:
+        return DecodeJson(*static_cast<double *>(p), s, r);
+      case Scalar::LongDouble:
+        return DecodeJson(*static_cast<long double *>(p), s, r);
+      case Scalar::String:
+        return DecodeJson(*static_cast<std::string *>(p), s, r);
+      case Scalar::None:
+        break;
+      }
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+    }
+
+    struct Step
+    {
+      detail::MemberAccess at{};
+      Scalar scalar{Scalar::None};
+      std::expected<void, Error> (*write)(const void *, JsonSerializer &, JsonWriter &){nullptr};
+      std::expected<void, Error> (*read)(void *, JsonSerializer &, JsonReader &){nullptr};
+      NGIN::UInt32 nested{0};
+    };
+
+    struct Plan
+    {
+      bool isEnum{false};
+      NGIN::UIntSize enumBytes{0};
+      // Objects: one step per named field. Enums: the value bits of each name.
+      NGIN::Containers::Vector<Step> fields;
+      NGIN::Containers::Vector<NGIN::UInt64> enumBits;
+      // `"name":` for fields, `"name"` for enum values; parallel to keys.keys.
+      NGIN::Containers::Vector<std::string> rendered;
+      KeyTable keys;
+    };
+
+    // Enum storage is read and written as its zero-extended bit pattern, matching
+    // EnumValueDescriptor::uvalue.
+    NGIN::UInt64 LoadBits(const void *p, NGIN::UIntSize bytes) noexcept
+    {
+      switch (bytes)
+      {
+      case 1:
+      {
+        std::uint8_t v;
+        std::memcpy(&v, p, 1);
+        return v;
+      }
+      case 2:
+      {
+        std::uint16_t v;
+        std::memcpy(&v, p, 2);
+        return v;
+      }
+      case 4:
+      {
+        std::uint32_t v;
+        std::memcpy(&v, p, 4);
+        return v;
+      }
+      default:
+      {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        return v;
+      }
+      }
+    }
+
+    void StoreBits(void *p, NGIN::UIntSize bytes, NGIN::UInt64 bits) noexcept
+    {
+      switch (bytes)
+      {
+      case 1:
+      {
+        const auto v = static_cast<std::uint8_t>(bits);
+        std::memcpy(p, &v, 1);
+        break;
+      }
+      case 2:
+      {
+        const auto v = static_cast<std::uint16_t>(bits);
+        std::memcpy(p, &v, 2);
+        break;
+      }
+      case 4:
+      {
+        const auto v = static_cast<std::uint32_t>(bits);
+        std::memcpy(p, &v, 4);
+        break;
+      }
+      default:
+        std::memcpy(p, &bits, 8);
+        break;
+      }
+    }
+  } // namespace
+
+  // JsonWriter
+  void JsonWriter::String(std::string_view text)
+  {
+    static constexpr char kHex[] = "0123456789abcdef";
+    m_out->push_back('"');
+    NGIN::UIntSize run = 0;
+    for (NGIN::UIntSize i = 0; i < text.size(); ++i)
+    {
+      const auto c = static_cast<unsigned char>(text[i]);
+      if (c != '"' && c != '\\' && c >= 0x20)
+        continue;
+      m_out->append(text.data() + run, i - run);
+      run = i + 1;
+      switch (c)
+      {
+      case '"':
+        m_out->append("\\\"");
+        break;
+      case '\\':
+        m_out->append("\\\\");
+        break;
+      case '\n':
+        m_out->append("\\n");
+        break;
+      case '\r':
+        m_out->append("\\r");
+        break;
+      case '\t':
+        m_out->append("\\t");
+        break;
+      case '\b':
+        m_out->append("\\b");
+        break;
+      case '\f':
+        m_out->append("\\f");
+        break;
+      default:
+        m_out->append("\\u00");
+        m_out->push_back(kHex[c >> 4]);
+        m_out->push_back(kHex[c & 0xF]);
+        break;
+      }
+    }
+    m_out->append(text.data() + run, text.size() - run);
+    m_out->push_back('"');
+  }
+
+  // JsonReader
+  bool JsonReader::ReadString(std::string_view &out, std::string &scratch)
+  {
+    if (!Consume('"'))
+      return Fail();
+    const auto start = m_pos;
+    while (m_pos < m_text.size())
+    {
+      const char c = m_text[m_pos];
+      if (c == '"')
+      {
+        out = m_text.substr(start, m_pos - start);
+        ++m_pos;
+        return true;
+      }
+      if (c == '\\')
+        break;
+      if (static_cast<unsigned char>(c) < 0x20)
+        return Fail();
+      ++m_pos;
+    }
+    if (m_pos >= m_text.size())
+      return Fail();
+
+    // Slow path: decode escapes into scratch.
+    scratch.assign(m_text.substr(start, m_pos - start));
+    while (m_pos < m_text.size())
+    {
+      const char c = m_text[m_pos++];
+      if (c == '"')
+      {
+        out = scratch;
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < 0x20)
+        return Fail();
+      if (c != '\\')
+      {
+        scratch.push_back(c);
+        continue;
+      }
+      if (m_pos >= m_text.size())
+        return Fail();
+      switch (m_text[m_pos++])
+      {
+      case '"':
+        scratch.push_back('"');
+        break;
+      case '\\':
+        scratch.push_back('\\');
+        break;
+      case '/':
+        scratch.push_back('/');
+        break;
+      case 'b':
+        scratch.push_back('\b');
+        break;
+      case 'f':
+        scratch.push_back('\f');
+        break;
+      case 'n':
+        scratch.push_back('\n');
+        break;
+      case 'r':
+        scratch.push_back('\r');
+        break;
+      case 't':
+        scratch.push_back('\t');
+        break;
+      case 'u':
+      {
+        NGIN::UInt32 cp = 0;
+        if (!ReadHex4(m_text, m_pos, cp))
+          return Fail();
+        if (cp >= 0xD800 && cp <= 0xDBFF)
+        {
+          NGIN::UInt32 low = 0;
+          if (m_text.substr(m_pos, 2) != "\\u")
+            return Fail();
+          m_pos += 2;
+          if (!ReadHex4(m_text, m_pos, low) || low < 0xDC00 || low > 0xDFFF)
+            return Fail();
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        }
+        else if (cp >= 0xDC00 && cp <= 0xDFFF)
+        {
+          return Fail();
+        }
+        AppendUtf8(scratch, cp);
+        break;
+      }
+      default:
+        return Fail();
+      }
+    }
+    return Fail();
+  }
+
+  bool JsonReader::ReadString(std::string &out)
+  {
+    std::string_view text;
+    if (!ReadString(text, out))
+      return false;
+    if (text.data() != out.data())
+      out.assign(text);
+    return true;
+  }
+
+  bool JsonReader::ReadNumber(std::string_view &out) noexcept
+  {
+    SkipWhitespace();
+    const auto start = m_pos;
+    while (m_pos < m_text.size())
+    {
+      const char c = m_text[m_pos];
+      if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
+        ++m_pos;
+      else
+        break;
+    }
+    if (m_pos == start)
+      return Fail();
+    out = m_text.substr(start, m_pos - start);
+    return true;
+  }
+
+  bool JsonReader::ReadLiteral(std::string_view literal) noexcept
+  {
+    SkipWhitespace();
+    if (m_text.substr(m_pos, literal.size()) != literal)
+      return Fail();
+    m_pos += literal.size();
+    return true;
+  }
+
+  bool JsonReader::ReadBool(bool &out) noexcept
+  {
+    if (Peek() == 't')
+    {
+      out = true;
+      return ReadLiteral("true");
+    }
+    out = false;
+    return ReadLiteral("false");
+  }
+
+  bool JsonReader::SkipString() noexcept
+  {
+    if (!Consume('"'))
+      return Fail();
+    while (m_pos < m_text.size())
+    {
+      const char c = m_text[m_pos++];
+      if (c == '"')
+        return true;
+      if (c == '\\')
+        ++m_pos;
+    }
+    return Fail();
+  }
+
+  // Starts at the decoders' current nesting so a skipped value cannot exceed the limit either.
+  bool JsonReader::SkipValue() { return SkipValue(m_depth); }
+
+  bool JsonReader::SkipValue(NGIN::UIntSize depth)
+  {
+    const char c = Peek();
+    if ((c == '{' || c == '[') && depth >= kMaxDepth)
+      return Fail();
+    switch (c)
+    {
+    case '"':
+      return SkipString();
+    case '{':
+      ++m_pos;
+      if (Consume('}'))
+        return true;
+      do
+      {
+        if (!SkipString() || !Expect(':') || !SkipValue(depth + 1))
+          return false;
+      } while (Consume(','));
+      return Expect('}');
+    case '[':
+      ++m_pos;
+      if (Consume(']'))
+        return true;
+      do
+      {
+        if (!SkipValue(depth + 1))
+          return false;
+      } while (Consume(','));
+      return Expect(']');
+    case 't':
+      return ReadLiteral("true");
+    case 'f':
+      return ReadLiteral("false");
+    case 'n':
+      return ReadLiteral("null");
+    default:
+    {
+      std::string_view token;
+      return ReadNumber(token);
+    }
+    }
+  }
+
+  // JsonSerializer
+  struct JsonSerializer::State
+  {
+    detail::PlanCache<Plan> plans;
+    // Decoded keys that contained escapes; only needed until the key is looked up.
+    std::string keyScratch;
+
+    // Caller holds the registry read lock.
+    std::expected<NGIN::UInt32, Error> Compile(const detail::Registry &reg, NGIN::UInt64 typeId)
+    {
+      return plans.Compile(reg, typeId, [&](const detail::TypeDescriptor &desc, Plan &plan) { return Build(reg, desc, plan); });
+    }
+
+    std::expected<void, Error> Build(const detail::Registry &reg, const detail::TypeDescriptor &desc, Plan &plan)
+    {
+      if (!desc.enumInfo.isEnum && desc.fields.Size() == 0)
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "type has no fields or enum values"});
+
+      std::string rendered;
+      JsonWriter w{rendered};
+      if (desc.enumInfo.isEnum)
+      {
+        plan.isEnum = true;
+        plan.enumBytes = desc.sizeBytes;
+        const auto &values = desc.enumInfo.values;
+        for (NGIN::UIntSize i = 0; i < values.Size(); ++i)
+        {
+          if (!plan.keys.Add(values[i].name))
+            continue;
+          rendered.clear();
+          w.String(values[i].name);
+          plan.rendered.PushBack(rendered);
+          plan.enumBits.PushBack(values[i].uvalue);
+        }
+      }
+      else
+      {
+        for (NGIN::UIntSize i = 0; i < desc.fields.Size(); ++i)
+        {
+          const auto &f = desc.fields[i];
+          // Unnamed fields have no key to write.
+          if (f.name.empty() || !plan.keys.Add(f.name))
+            continue;
+          Step step{};
+          step.at = detail::MemberAccess::Of(f);
+          // Scalars and strings run inline; containers need their registration-time codec.
+          step.scalar = ScalarOf(f.typeId);
+          if (step.scalar == Scalar::None && f.WriteJson && f.ReadJson)
+          {
+            step.write = f.WriteJson;
+            step.read = f.ReadJson;
+          }
+          else if (step.scalar == Scalar::None)
+          {
+            const auto *nestedIndex = reg.byTypeId.GetPtr(f.typeId);
+            if (!nestedIndex || (!reg.types[*nestedIndex].enumInfo.isEnum && reg.types[*nestedIndex].fields.Size() == 0))
+              return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+            auto nested = Compile(reg, f.typeId);
+            if (!nested.has_value())
+              return std::unexpected(Error{ErrorCode::InvalidArgument, "field type is not serializable"});
+            step.nested = *nested;
+          }
+          rendered.clear();
+          w.String(f.name);
+          w.Raw(':');
+          plan.rendered.PushBack(rendered);
+          plan.fields.PushBack(step);
+        }
+      }
+      plan.keys.Build();
+      return {};
+    }
+  };
+
+  JsonSerializer::JsonSerializer() : m_state(std::make_unique<State>()) {}
+  JsonSerializer::~JsonSerializer() = default;
+  JsonSerializer::JsonSerializer(JsonSerializer &&) noexcept = default;
+  JsonSerializer &JsonSerializer::operator=(JsonSerializer &&) noexcept = default;
+
+  NGIN::UIntSize JsonSerializer::PlanCount() const noexcept { return m_state ? m_state->plans.Size() : 0; }
+
+  bool JsonSerializer::HasPlan(NGIN::UInt64 typeId) const noexcept
+  {
+    return m_state && m_state->plans.Find(typeId) != nullptr;
+  }
+
+  void JsonSerializer::Clear() noexcept
+  {
+    if (m_state)
+      m_state->plans.Clear();
+  }
+
+  // Called inside a PlanCache scope (see WriteObject/ReadObject).
+  std::expected<NGIN::UInt32, Error> JsonSerializer::PlanFor(NGIN::UInt64 typeId)
+  {
+    auto &s = *m_state;
+    return s.plans.Get(typeId,
+                       [&]
+                       {
+                         [[maybe_unused]] auto lock = detail::LockRegistryRead();
+                         return s.Compile(detail::GetRegistry(), typeId);
+                       });
+  }
+
+  std::expected<void, Error> JsonSerializer::RunWrite(NGIN::UInt32 plan, const void *obj, JsonWriter &out)
+  {
+    // Codecs may compile further plans and grow the table, so nothing is held across them.
+    if (m_state->plans[plan].isEnum)
+    {
+      const auto &p = m_state->plans[plan];
+      const auto bits = LoadBits(obj, p.enumBytes);
+      for (NGIN::UIntSize i = 0; i < p.enumBits.Size(); ++i)
+      {
+        if (p.enumBits[i] == bits)
+        {
+          out.Raw(p.rendered[i]);
+          return {};
+        }
+      }
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "enum value has no name"});
+    }
+
+    out.Raw('{');
+    for (NGIN::UIntSize i = 0; i < m_state->plans[plan].fields.Size(); ++i)
+    {
+      if (i > 0)
+        out.Raw(',');
+      out.Raw(m_state->plans[plan].rendered[i]);
+      const Step step = m_state->plans[plan].fields[i];
+      const auto *member = step.at.In(obj);
+      auto r = step.scalar != Scalar::None ? WriteScalar(step.scalar, member, *this, out)
+               : step.write                 ? step.write(member, *this, out)
+                                            : RunWrite(step.nested, member, out);
+      if (!r.has_value())
+        return r;
+    }
+    out.Raw('}');
+    return {};
+  }
+
+  std::expected<void, Error> JsonSerializer::RunRead(NGIN::UInt32 plan, void *obj, JsonReader &in)
+  {
+    if (m_state->plans[plan].isEnum)
+    {
+      const auto &p = m_state->plans[plan];
+      std::string_view name;
+      if (!in.ReadString(name, m_state->keyScratch))
+        return std::unexpected(detail::MalformedJson());
+      const auto index = p.keys.Find(name);
+      if (index == kNoKey)
+        return std::unexpected(Error{ErrorCode::NotFound, "unknown enum name"});
+      StoreBits(obj, p.enumBytes, p.enumBits[index]);
+      return {};
+    }
+
+    JsonReader::Nesting nesting{in};
+    if (!nesting || !in.Expect('{'))
+      return std::unexpected(detail::MalformedJson());
+    if (in.Consume('}'))
+      return {};
+    do
+    {
+      std::string_view key;
+      if (!in.ReadString(key, m_state->keyScratch) || !in.Expect(':'))
+        return std::unexpected(detail::MalformedJson());
+      const auto index = m_state->plans[plan].keys.Find(key);
+      if (index == kNoKey)
+      {
+        if (!in.SkipValue())
+          return std::unexpected(detail::MalformedJson());
+        continue;
+      }
+      const Step step = m_state->plans[plan].fields[index];
+      auto *member = step.at.In(obj);
+      auto r = step.scalar != Scalar::None ? ReadScalar(step.scalar, member, *this, in)
+               : step.read                  ? step.read(member, *this, in)
+                                            : RunRead(step.nested, member, in);
+      if (!r.has_value())
+        return r;
+    } while (in.Consume(','));
+    if (!in.Expect('}'))
+      return std::unexpected(detail::MalformedJson());
+    return {};
+  }
+
+  std::expected<void, Error> JsonSerializer::WriteObject(NGIN::UInt64 typeId, const void *obj, JsonWriter &out)
+  {
+    if (!m_state)
+      m_state = std::make_unique<State>();
+    // Element codecs re-enter here; only the outermost call may drop stale plans.
+    auto scope = m_state->plans.Enter();
+    auto plan = PlanFor(typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    return RunWrite(*plan, obj, out);
+  }
+
+  std::expected<void, Error> JsonSerializer::ReadObject(NGIN::UInt64 typeId, void *obj, JsonReader &in)
+  {
+    if (!m_state)
+      m_state = std::make_unique<State>();
+    auto scope = m_state->plans.Enter();
+    auto plan = PlanFor(typeId);
+    if (!plan.has_value())
+      return std::unexpected(std::move(plan.error()));
+    return RunRead(*plan, obj, in);
+  }
+
+  std::expected<void, Error> JsonSerializer::Write(Type type, const void *obj, JsonWriter &out)
+  {
+    if (!type.IsValid())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    return WriteObject(type.GetTypeId(), obj, out);
+  }
+
+  std::expected<void, Error> JsonSerializer::Read(Type type, void *obj, JsonReader &in)
+  {
+    if (!type.IsValid())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    return ReadObject(type.GetTypeId(), obj, in);
+  }
+
+  std::expected<void, Error> JsonSerializer::Write(Type type, const void *obj, std::string &out)
+  {
+    JsonWriter w{out};
+    return Write(type, obj, w);
+  }
+
+  std::expected<NGIN::UIntSize, Error> JsonSerializer::Read(Type type, void *obj, std::string_view json)
+  {
+    JsonReader in{json};
+    if (auto r = Read(type, obj, in); !r.has_value())
+      return std::unexpected(std::move(r.error()));
+    in.SkipWhitespace();
+    return in.Consumed();
+  }
+} // namespace NGIN::Reflection
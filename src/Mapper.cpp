@@ -0,0 +1,268 @@
+#include <NGIN/Reflection/Mapper.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace NGIN::Reflection
+{
+  namespace
+  {
+    const detail::TypeDescriptor *ReflectedClass(const detail::Registry &reg, NGIN::UInt64 typeId) noexcept
+    {
+      const auto *idx = reg.byTypeId.GetPtr(typeId);
+      if (!idx)
+        return nullptr;
+      const auto &tdesc = reg.types[*idx];
+      return tdesc.fields.Size() ? &tdesc : nullptr;
+    }
+
+    bool HasOffsets(const detail::TypeDescriptor &tdesc) noexcept
+    {
+      for (NGIN::UIntSize i = 0; i < tdesc.fields.Size(); ++i)
+      {
+        if (tdesc.fields[i].offset == detail::kNoFieldOffset)
+          return false;
+      }
+      return true;
+    }
+  } // namespace
+
+  struct Mapper::Builder
+  {
+    const detail::Registry &reg;
+    Mapper &out;
+
+    // Steps of one plan level. Copies of members with known offsets on both sides are kept
+    // apart (with offsets relative to the level's objects) so they can be merged.
+    struct Level
+    {
+      NGIN::Containers::Vector<Step> copies;
+      NGIN::Containers::Vector<Step> others;
+    };
+
+    // Fields merged from an ABI blob may have neither an offset nor an accessor; such a
+    // member cannot be located and fails the compile.
+    static std::expected<void, Error> Address(Step &step, const detail::FieldDescriptor &s, const detail::FieldDescriptor &d,
+                                              NGIN::UIntSize srcBase, NGIN::UIntSize dstBase) noexcept
+    {
+      if ((s.offset == detail::kNoFieldOffset && !s.GetConst) || (d.offset == detail::kNoFieldOffset && !d.GetMut))
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "field has no offset or accessor"});
+      if (s.offset != detail::kNoFieldOffset)
+        step.srcOffset = srcBase + s.offset;
+      else
+        step.getConst = s.GetConst;
+      if (d.offset != detail::kNoFieldOffset)
+        step.dstOffset = dstBase + d.offset;
+      else
+        step.getMut = d.GetMut;
+      return {};
+    }
+
+    // Members of src/dst at srcBase/dstBase inside the level's objects.
+    std::expected<void, Error> Walk(const detail::TypeDescriptor &src, const detail::TypeDescriptor &dst,
+                                    NGIN::UIntSize srcBase, NGIN::UIntSize dstBase, Level &level)
+    {
+      for (NGIN::UIntSize i = 0; i < dst.fields.Size(); ++i)
+      {
+        const auto &d = dst.fields[i];
+        const bool dstInline = d.offset != detail::kNoFieldOffset;
+        const detail::FieldDescriptor *s = nullptr;
+        if (!d.name.empty())
+        {
+          NameId nid{};
+          (void)detail::FindNameId(d.name, nid);
+          if (const auto *idx = src.fieldIndex.GetPtr(nid))
+            s = &src.fields[*idx];
+        }
+        if (!s)
+          continue;
+        const bool srcInline = s->offset != detail::kNoFieldOffset;
+
+        Step step{};
+        if (s->typeId != d.typeId)
+        {
+          const auto *srcClass = ReflectedClass(reg, s->typeId);
+          const auto *dstClass = srcClass ? ReflectedClass(reg, d.typeId) : nullptr;
+          if (dstClass && srcInline && dstInline && HasOffsets(*srcClass) && HasOffsets(*dstClass))
+          {
+            // Both layouts are fixed: splice the nested fields into this level.
+            if (auto r = Walk(*srcClass, *dstClass, srcBase + s->offset, dstBase + d.offset, level); !r.has_value())
+              return r;
+            continue;
+          }
+          if (dstClass)
+          {
+            auto child = Emit(*srcClass, *dstClass);
+            if (!child.has_value())
+              return std::unexpected(std::move(child.error()));
+            if (child->count == 0)
+              continue;
+            step.kind = StepKind::Nested;
+            step.first = child->first;
+            step.count = child->count;
+          }
+          else if (auto convert = d.triviallyCopyable ? detail::FindValuePreservingConverter(s->typeId, d.typeId) : nullptr)
+          {
+            step.kind = StepKind::Convert;
+            step.convert = convert;
+            ++out.m_mappedFields;
+          }
+          else
+          {
+            continue;
+          }
+        }
+        else if (d.triviallyCopyable)
+        {
+          step.kind = StepKind::Copy;
+          step.size = d.sizeBytes;
+          ++out.m_mappedFields;
+        }
+        else if (d.CopyAssign)
+        {
+          step.kind = StepKind::Assign;
+          step.assign = d.CopyAssign;
+          ++out.m_mappedFields;
+        }
+        else
+        {
+          continue;
+        }
+
+        if (auto r = Address(step, *s, d, srcBase, dstBase); !r.has_value())
+          return r;
+        if (step.kind == StepKind::Copy && srcInline && dstInline)
+          level.copies.PushBack(step);
+        else
+          level.others.PushBack(step);
+      }
+      return {};
+    }
+
+    struct Range
+    {
+      NGIN::UInt32 first{0};
+      NGIN::UInt32 count{0};
+    };
+
+    // Compiles one level and appends it after any nested levels it needed.
+    std::expected<Range, Error> Emit(const detail::TypeDescriptor &src, const detail::TypeDescriptor &dst)
+    {
+      Level level;
+      if (auto r = Walk(src, dst, 0, 0, level); !r.has_value())
+        return std::unexpected(std::move(r.error()));
+
+      auto *copies = level.copies.data();
+      std::sort(copies, copies + level.copies.Size(),
+                [](const Step &a, const Step &b)
+                { return a.dstOffset < b.dstOffset; });
+      NGIN::Containers::Vector<Step> merged;
+      for (NGIN::UIntSize i = 0; i < level.copies.Size(); ++i)
+      {
+        const auto &c = copies[i];
+        if (merged.Size() != 0)
+        {
+          // Only ranges that touch on both sides: the bytes between two fields may be
+          // padding in one type and data in the other.
+          auto &last = merged[merged.Size() - 1];
+          if (c.dstOffset == last.dstOffset + last.size && c.srcOffset == last.srcOffset + last.size)
+          {
+            last.size += c.size;
+            continue;
+          }
+        }
+        merged.PushBack(c);
+      }
+
+      Range range{static_cast<NGIN::UInt32>(out.m_steps.Size()),
+                  static_cast<NGIN::UInt32>(merged.Size() + level.others.Size())};
+      for (NGIN::UIntSize i = 0; i < merged.Size(); ++i)
+        out.m_steps.PushBack(merged[i]);
+      for (NGIN::UIntSize i = 0; i < level.others.Size(); ++i)
+        out.m_steps.PushBack(level.others[i]);
+      return range;
+    }
+  };
+
+  std::expected<Mapper, Error> Mapper::Compile(const Type &src, const Type &dst)
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, src.Handle()) || !detail::IsTypeAlive(reg, dst.Handle()))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    const auto &srcDesc = reg.types[src.Handle().index];
+    const auto &dstDesc = reg.types[dst.Handle().index];
+
+    Mapper out;
+    out.m_srcTypeId = srcDesc.typeId;
+    out.m_dstTypeId = dstDesc.typeId;
+    out.m_srcSize = srcDesc.sizeBytes;
+    out.m_dstSize = dstDesc.sizeBytes;
+    Builder builder{reg, out};
+    auto root = builder.Emit(srcDesc, dstDesc);
+    if (!root.has_value())
+      return std::unexpected(std::move(root.error()));
+    out.m_rootFirst = root->first;
+    out.m_rootCount = root->count;
+    return out;
+  }
+
+  NGIN::UIntSize Mapper::CopyRangeCount() const noexcept
+  {
+    NGIN::UIntSize n = 0;
+    for (NGIN::UIntSize i = 0; i < m_steps.Size(); ++i)
+    {
+      if (m_steps[i].kind == StepKind::Copy)
+        ++n;
+    }
+    return n;
+  }
+
+  void Mapper::Run(NGIN::UInt32 first, NGIN::UInt32 count, const void *src, void *dst) const
+  {
+    for (NGIN::UInt32 i = first; i < first + count; ++i)
+    {
+      const auto &step = m_steps[i];
+      const void *from = step.getConst ? step.getConst(src) : static_cast<const unsigned char *>(src) + step.srcOffset;
+      void *to = step.getMut ? step.getMut(dst) : static_cast<unsigned char *>(dst) + step.dstOffset;
+      switch (step.kind)
+      {
+      case StepKind::Copy:
+        std::memcpy(to, from, step.size);
+        break;
+      case StepKind::Convert:
+        step.convert(from, to);
+        break;
+      case StepKind::Assign:
+        step.assign(to, from);
+        break;
+      case StepKind::Nested:
+        Run(step.first, step.count, from, to);
+        break;
+      }
+    }
+  }
+
+  void Mapper::Apply(const void *src, void *dst) const
+  {
+    Run(m_rootFirst, m_rootCount, src, dst);
+  }
+
+  void Mapper::ApplyArray(const void *src, void *dst, NGIN::UIntSize count) const
+  {
+    if (m_rootCount == 0 || count == 0)
+      return;
+    // One range covering both whole objects: the arrays are the same bytes.
+    const auto &head = m_steps[m_rootFirst];
+    if (m_rootCount == 1 && head.kind == StepKind::Copy && !head.getConst && !head.getMut && head.srcOffset == 0 &&
+        head.dstOffset == 0 && head.size == m_srcSize && head.size == m_dstSize)
+    {
+      std::memcpy(dst, src, count * m_srcSize);
+      return;
+    }
+    const auto *s = static_cast<const unsigned char *>(src);
+    auto *d = static_cast<unsigned char *>(dst);
+    for (NGIN::UIntSize i = 0; i < count; ++i)
+      Run(m_rootFirst, m_rootCount, s + i * m_srcSize, d + i * m_dstSize);
+  }
+} // namespace NGIN::Reflection
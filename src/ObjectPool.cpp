@@ -0,0 +1,223 @@
+#include <NGIN/Reflection/ObjectPool.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace NGIN::Reflection::detail
+{
+  struct PoolState
+  {
+    Type type{};
+    ModuleId moduleId{0};
+    void (*destroy)(void *){nullptr};
+    NGIN::UIntSize stride{0};
+    NGIN::UIntSize alignment{0};
+    NGIN::UIntSize slabSlots{0};
+    NGIN::Containers::Vector<unsigned char *> slabs;
+    NGIN::Containers::Vector<NGIN::UInt32> generations;
+    NGIN::Containers::Vector<NGIN::UInt8> alive;
+    NGIN::Containers::Vector<NGIN::UInt32> freeList;
+    NGIN::UIntSize live{0};
+    std::atomic<bool> released{false};
+    // Serializes the owner's Create/Destroy/Clear with ReleaseModulePools.
+    std::mutex mutex;
+
+    ~PoolState();
+
+    void *Slot(NGIN::UInt32 index) const noexcept
+    {
+      return slabs[index / slabSlots] + (index % slabSlots) * stride;
+    }
+
+    void Grow()
+    {
+      auto *slab = static_cast<unsigned char *>(::operator new(stride * slabSlots, std::align_val_t{alignment}));
+      const auto first = static_cast<NGIN::UInt32>(slabs.Size() * slabSlots);
+      slabs.PushBack(slab);
+      for (NGIN::UIntSize i = 0; i < slabSlots; ++i)
+      {
+        generations.PushBack(0);
+        alive.PushBack(0);
+      }
+      // Reverse order so the lowest index is handed out first.
+      for (NGIN::UIntSize i = slabSlots; i > 0; --i)
+        freeList.PushBack(first + static_cast<NGIN::UInt32>(i - 1));
+    }
+
+    void Release(NGIN::UInt32 index) noexcept
+    {
+      destroy(Slot(index));
+      alive[index] = 0;
+      ++generations[index];
+      freeList.PushBack(index);
+      --live;
+    }
+
+    void Clear() noexcept
+    {
+      for (NGIN::UIntSize i = 0; i < alive.Size() && live > 0; ++i)
+      {
+        if (alive[i])
+          Release(static_cast<NGIN::UInt32>(i));
+      }
+    }
+  };
+
+  namespace
+  {
+    struct PoolEntry
+    {
+      PoolState *state{nullptr};
+      std::weak_ptr<PoolState> ref;
+    };
+
+    std::mutex g_poolsMutex;
+    NGIN::Containers::Vector<PoolEntry> g_pools;
+  } // namespace
+
+  PoolState::~PoolState()
+  {
+    {
+      std::lock_guard lock{g_poolsMutex};
+      for (NGIN::UIntSize i = 0; i < g_pools.Size(); ++i)
+      {
+        if (g_pools[i].state == this)
+        {
+          g_pools[i] = g_pools[g_pools.Size() - 1];
+          g_pools.PopBack();
+          break;
+        }
+      }
+    }
+    // Last reference: no other thread can reach the pool any more. Destructors run without
+    // g_poolsMutex since they may drop other pools.
+    if (!released)
+      Clear();
+    for (NGIN::UIntSize i = 0; i < slabs.Size(); ++i)
+      ::operator delete(slabs[i], std::align_val_t{alignment});
+  }
+
+  void ReleaseModulePools(ModuleId moduleId) noexcept
+  {
+    // Pin the module's pools under the list lock, then destroy their objects after
+    // unlocking; an owner dropping its pool meanwhile leaves the last reference to us.
+    NGIN::Containers::Vector<std::shared_ptr<PoolState>> pinned;
+    {
+      std::lock_guard lock{g_poolsMutex};
+      for (NGIN::UIntSize i = 0; i < g_pools.Size(); ++i)
+      {
+        if (auto pool = g_pools[i].ref.lock(); pool && pool->moduleId == moduleId)
+          pinned.PushBack(std::move(pool));
+      }
+    }
+    for (NGIN::UIntSize i = 0; i < pinned.Size(); ++i)
+    {
+      auto &pool = *pinned[i];
+      std::lock_guard poolLock{pool.mutex};
+      if (pool.released)
+        continue;
+      pool.Clear();
+      pool.released = true;
+    }
+  }
+} // namespace NGIN::Reflection::detail
+
+namespace NGIN::Reflection
+{
+  ObjectPool::ObjectPool(std::shared_ptr<detail::PoolState> state) noexcept : m_state(std::move(state)) {}
+  ObjectPool::~ObjectPool() = default;
+  ObjectPool::ObjectPool(ObjectPool &&other) noexcept = default;
+  ObjectPool &ObjectPool::operator=(ObjectPool &&other) noexcept = default;
+
+  bool ObjectPool::IsValid() const noexcept { return m_state && !m_state->released; }
+  Type ObjectPool::GetType() const noexcept { return m_state ? m_state->type : Type{}; }
+  NGIN::UIntSize ObjectPool::Size() const noexcept { return m_state ? m_state->live : 0; }
+  NGIN::UIntSize ObjectPool::Capacity() const noexcept { return m_state ? m_state->alive.Size() : 0; }
+
+  std::expected<PoolHandle, Error> ObjectPool::Create(const Any *args, NGIN::UIntSize count)
+  {
+    if (!m_state)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "pool released"});
+    auto &s = *m_state;
+    std::lock_guard lock{s.mutex};
+    if (s.released)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "pool released"});
+    if (s.freeList.Size() == 0)
+      s.Grow();
+    const auto index = s.freeList[s.freeList.Size() - 1];
+    s.freeList.PopBack();
+    std::expected<void, Error> built;
+    try
+    {
+      built = s.type.ConstructAt(s.Slot(index), args, count);
+    }
+    catch (...)
+    {
+      s.freeList.PushBack(index);
+      throw;
+    }
+    if (!built.has_value())
+    {
+      s.freeList.PushBack(index);
+      return std::unexpected(built.error());
+    }
+    s.alive[index] = 1;
+    ++s.live;
+    return PoolHandle{index, s.generations[index]};
+  }
+
+  std::expected<void, Error> ObjectPool::Destroy(PoolHandle h)
+  {
+    if (!m_state)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "stale pool handle"});
+    std::lock_guard lock{m_state->mutex};
+    if (!Get(h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "stale pool handle"});
+    m_state->Release(h.index);
+    return {};
+  }
+
+  void ObjectPool::Clear() noexcept
+  {
+    if (!m_state)
+      return;
+    std::lock_guard lock{m_state->mutex};
+    m_state->Clear();
+  }
+
+  void *ObjectPool::Get(PoolHandle h) const noexcept
+  {
+    if (!m_state || h.index >= m_state->alive.Size())
+      return nullptr;
+    if (!m_state->alive[h.index] || m_state->generations[h.index] != h.generation)
+      return nullptr;
+    return m_state->Slot(h.index);
+  }
+
+  std::expected<ObjectPool, Error> Type::CreatePool(NGIN::UIntSize capacity) const
+  {
+    if (capacity == 0)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "pool capacity must be non-zero"});
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = detail::GetRegistry();
+    if (!detail::IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, detail::kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    if (!tdesc.Destroy || tdesc.sizeBytes == 0)
+      return std::unexpected(Error{ErrorCode::NotFound, "type has no lifecycle thunks"});
+
+    auto state = std::make_shared<detail::PoolState>();
+    state->type = *this;
+    state->moduleId = tdesc.moduleId;
+    state->destroy = tdesc.Destroy;
+    state->alignment = tdesc.alignBytes ? tdesc.alignBytes : 1;
+    state->stride = (tdesc.sizeBytes + state->alignment - 1) / state->alignment * state->alignment;
+    state->slabSlots = capacity;
+    {
+      std::lock_guard poolsLock{detail::g_poolsMutex};
+      detail::g_pools.PushBack(detail::PoolEntry{state.get(), state});
+    }
+    return ObjectPool{std::move(state)};
+  }
+} // namespace NGIN::Reflection
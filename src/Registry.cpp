@@ -1,10 +1,15 @@
 #include <NGIN/Reflection/Registry.hpp>
 #include <NGIN/Reflection/NameUtils.hpp>
+#include <NGIN/Reflection/ObjectPool.hpp>
+#include <atomic>
+#include <tuple>
 #include <cstring>
 #include <optional>
 #include <new>
 #include <exception>
 #include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
@@ -12,9 +17,160 @@ namespace NGIN::Reflection::detail
 {
 
   static Registry g_registry{};
+  static std::atomic<NGIN::UInt64> g_registryEpoch{1};
 
   Registry &GetRegistry() noexcept { return g_registry; }
 
+  NGIN::UInt64 RegistryEpoch() noexcept { return g_registryEpoch.load(std::memory_order_acquire); }
+  void BumpRegistryEpoch() noexcept { g_registryEpoch.fetch_add(1, std::memory_order_acq_rel); }
+
+  namespace
+  {
+    using ArithmeticTypes = std::tuple<bool, signed char, unsigned char, char, short, unsigned short, int, unsigned int,
+                                       long, unsigned long, long long, unsigned long long, float, double, long double>;
+
+    template <class From, class To>
+    void ConvertArg(const void *src, void *dst)
+    {
+      ::new (dst) To(static_cast<To>(*static_cast<const From *>(src)));
+    }
+
+    // Every From value converts to To and back unchanged.
+    template <class From, class To>
+    constexpr bool IsValuePreserving() noexcept
+    {
+      using FromLimits = std::numeric_limits<From>;
+      using ToLimits = std::numeric_limits<To>;
+      if constexpr (std::is_same_v<From, To>)
+        return true;
+      else if constexpr (std::is_same_v<To, bool>)
+        return false;
+      else if constexpr (std::is_same_v<From, bool>)
+        return true;
+      else if constexpr (std::is_integral_v<From> && std::is_integral_v<To>)
+        return (!std::is_signed_v<From> || std::is_signed_v<To>) &&
+               static_cast<std::uintmax_t>(ToLimits::max()) >= static_cast<std::uintmax_t>(FromLimits::max());
+      else if constexpr (std::is_integral_v<From>)
+        return FromLimits::digits <= ToLimits::digits;
+      else if constexpr (std::is_floating_point_v<To>)
+        return FromLimits::digits <= ToLimits::digits && FromLimits::max_exponent <= ToLimits::max_exponent &&
+               FromLimits::min_exponent >= ToLimits::min_exponent;
+      else
+        return false;
+    }
+
+    template <bool ValuePreserving, class To, class... From>
+    ArgConverter FindConverterFrom(NGIN::UInt64 from, std::tuple<From...> *) noexcept
+    {
+      ArgConverter out = nullptr;
+      (void)((from == TypeIdOf<From>()
+                  ? (out = (!ValuePreserving || IsValuePreserving<From, To>()) ? &ConvertArg<From, To> : nullptr, true)
+                  : false) ||
+             ...);
+      return out;
+    }
+
+    template <bool ValuePreserving, class... To>
+    ArgConverter FindConverterTo(NGIN::UInt64 from, NGIN::UInt64 to, std::tuple<To...> *) noexcept
+    {
+      ArgConverter out = nullptr;
+      (void)((to == TypeIdOf<To>()
+                  ? (out = FindConverterFrom<ValuePreserving, To>(from, static_cast<ArithmeticTypes *>(nullptr)), true)
+                  : false) ||
+             ...);
+      return out;
+    }
+  } // namespace
+
+  void AddOverload(OverloadDispatch &dispatch, NGIN::UInt32 index, const NGIN::Containers::Vector<NGIN::UInt64> &paramTypeIds,
+                   NGIN::UInt64 signatureHash)
+  {
+    const auto arity = paramTypeIds.Size();
+    while (dispatch.byArity.Size() <= arity)
+      dispatch.byArity.PushBack(NGIN::Containers::Vector<NGIN::UInt32>{});
+    dispatch.byArity[arity].PushBack(index);
+    const auto h = ParamSignatureHash(arity ? &paramTypeIds[0] : nullptr, arity);
+    if (!dispatch.exact.GetPtr(h))
+      dispatch.exact.Insert(h, index);
+    if (!dispatch.bySignature.GetPtr(signatureHash))
+      dispatch.bySignature.Insert(signatureHash, index);
+  }
+
+  ArgConverter FindArgConverter(NGIN::UInt64 from, NGIN::UInt64 to) noexcept
+  {
+    if (auto convert = FindConverterTo<false>(from, to, static_cast<ArithmeticTypes *>(nullptr)))
+      return convert;
+    int cost = 0;
+    return FindUserConversion(from, to, cost);
+  }
+
+  ArgConverter FindValuePreservingConverter(NGIN::UInt64 from, NGIN::UInt64 to) noexcept
+  {
+    if (auto convert = FindConverterTo<true>(from, to, static_cast<ArithmeticTypes *>(nullptr)))
+      return convert;
+    int cost = 0;
+    return FindUserConversion(from, to, cost);
+  }
+
+  void ArgPlan::BuildExact(const NGIN::UInt64 *ids, NGIN::UIntSize count)
+  {
+    m_count = static_cast<NGIN::UInt32>(count);
+    m_needsConversion = false;
+    m_hasAllConverters = true;
+    NGIN::UInt64 *dst = m_inlineIds.data();
+    ArgConverter *converters = m_inlineConverters.data();
+    if (count > kInlineArgCapacity)
+    {
+      m_heapIds.Clear();
+      m_heapConverters.Clear();
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        m_heapIds.PushBack(0);
+        m_heapConverters.PushBack(nullptr);
+      }
+      dst = m_heapIds.data();
+      converters = m_heapConverters.data();
+    }
+    for (NGIN::UIntSize i = 0; i < count; ++i)
+    {
+      dst[i] = ids[i];
+      converters[i] = nullptr;
+    }
+  }
+
+  void ArgPlan::Build(const NGIN::Containers::Vector<NGIN::UInt64> &paramTypeIds, const Any *args, NGIN::UIntSize count)
+  {
+    m_count = static_cast<NGIN::UInt32>(count);
+    m_needsConversion = false;
+    m_hasAllConverters = true;
+    NGIN::UInt64 *ids = m_inlineIds.data();
+    ArgConverter *converters = m_inlineConverters.data();
+    if (count > kInlineArgCapacity)
+    {
+      m_heapIds.Clear();
+      m_heapConverters.Clear();
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        m_heapIds.PushBack(0);
+        m_heapConverters.PushBack(nullptr);
+      }
+      ids = m_heapIds.data();
+      converters = m_heapConverters.data();
+    }
+    for (NGIN::UIntSize i = 0; i < count; ++i)
+    {
+      const auto have = ArgTypeId(args[i]);
+      ids[i] = have;
+      converters[i] = nullptr;
+      if (have == paramTypeIds[i])
+        continue;
+      m_needsConversion = true;
+      converters[i] = FindArgConverter(have, paramTypeIds[i]);
+      if (!converters[i])
+        m_hasAllConverters = false;
+    }
+  }
+
   namespace
   {
     enum class LockMode
@@ -408,9 +564,32 @@ namespace NGIN::Reflection
   using detail::IsMethodAlive;
   using detail::IsPropertyAlive;
   using detail::IsTypeAlive;
+  using detail::kStaleHandle;
   namespace
   {
-    constexpr std::string_view kStaleHandle = "stale handle";
+    // Checks a value against a field before any write. Fields without a Store thunk take the
+    // value by a size-checked memcpy through GetMut (see WriteFieldValue).
+    std::expected<void, Error> CheckFieldValue(const detail::FieldDescriptor &f, const Any &value)
+    {
+      if (value.GetTypeId() != f.typeId)
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "type-id mismatch"});
+      if (f.Store)
+        return {};
+      if (!f.GetMut)
+        return std::unexpected(Error{ErrorCode::NotFound, "field is not writable"});
+      if (value.Size() != f.sizeBytes)
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "size mismatch"});
+      return {};
+    }
+
+    // Writes a value accepted by CheckFieldValue.
+    std::expected<void, Error> WriteFieldValue(const detail::FieldDescriptor &f, void *obj, const Any &value)
+    {
+      if (f.Store)
+        return f.Store(obj, value);
+      std::memcpy(f.GetMut(obj), value.Data(), f.sizeBytes);
+      return {};
+    }
   } // namespace
 
   // Type
@@ -468,6 +647,89 @@ namespace NGIN::Reflection
     return Field{FieldHandle{m_h.index, static_cast<NGIN::UInt32>(i), m_h.generation}};
   }
 
+  std::expected<NGIN::UIntSize, Error> Type::ReadFields(const void *obj, std::span<Any> out) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &fields = reg.types[m_h.index].fields;
+    if (out.size() < fields.Size())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "output span too small"});
+    for (NGIN::UIntSize i = 0; i < fields.Size(); ++i)
+      out[i] = fields[i].Load ? fields[i].Load(obj) : Any::MakeVoid();
+    return fields.Size();
+  }
+
+  std::expected<void, Error> Type::WriteFields(void *obj, std::span<const Any> values) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &fields = reg.types[m_h.index].fields;
+    if (values.size() != fields.Size())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "value count mismatch"});
+    for (NGIN::UIntSize i = 0; i < fields.Size(); ++i)
+    {
+      if (auto r = CheckFieldValue(fields[i], values[i]); !r.has_value())
+        return r;
+    }
+    for (NGIN::UIntSize i = 0; i < fields.Size(); ++i)
+    {
+      if (auto r = WriteFieldValue(fields[i], obj, values[i]); !r.has_value())
+        return r;
+    }
+    return {};
+  }
+
+  std::expected<void, Error> Type::ReadFields(const void *obj, std::span<const Field> fields, std::span<Any> out) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    if (out.size() < fields.size())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "output span too small"});
+    const auto &table = reg.types[m_h.index].fields;
+    for (const auto &f : fields)
+    {
+      if (f.m_h.typeIndex != m_h.index || f.m_h.typeGeneration != m_h.generation || f.m_h.fieldIndex >= table.Size())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "field does not belong to type"});
+    }
+    for (NGIN::UIntSize i = 0; i < fields.size(); ++i)
+    {
+      const auto &f = table[fields[i].m_h.fieldIndex];
+      out[i] = f.Load ? f.Load(obj) : Any::MakeVoid();
+    }
+    return {};
+  }
+
+  std::expected<void, Error> Type::WriteFields(void *obj, std::span<const Field> fields, std::span<const Any> values) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    if (values.size() != fields.size())
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "value count mismatch"});
+    const auto &table = reg.types[m_h.index].fields;
+    for (NGIN::UIntSize i = 0; i < fields.size(); ++i)
+    {
+      const auto &h = fields[i].m_h;
+      if (h.typeIndex != m_h.index || h.typeGeneration != m_h.generation || h.fieldIndex >= table.Size())
+        return std::unexpected(Error{ErrorCode::InvalidArgument, "field does not belong to type"});
+      if (auto r = CheckFieldValue(table[h.fieldIndex], values[i]); !r.has_value())
+        return r;
+    }
+    for (NGIN::UIntSize i = 0; i < fields.size(); ++i)
+    {
+      if (auto r = WriteFieldValue(table[fields[i].m_h.fieldIndex], obj, values[i]); !r.has_value())
+        return r;
+    }
+    return {};
+  }
+
   ExpectedField Type::GetField(std::string_view name) const
   {
     [[maybe_unused]] auto lock = detail::LockRegistryRead();
@@ -689,6 +951,44 @@ namespace NGIN::Reflection
     return reg.types[m_h.typeIndex].fields[m_h.fieldIndex].GetConst(obj);
   }
 
+  std::optional<NGIN::UIntSize> Field::Offset() const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsFieldAlive(reg, m_h))
+      return std::nullopt;
+    const auto offset = reg.types[m_h.typeIndex].fields[m_h.fieldIndex].offset;
+    if (offset == detail::kNoFieldOffset)
+      return std::nullopt;
+    return offset;
+  }
+
+  std::expected<void, Error> Field::Gather(const void *base, NGIN::UIntSize stride, NGIN::UIntSize count, void *out) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsFieldAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
+    if (!f.Gather)
+      return std::unexpected(Error{ErrorCode::NotFound, "field is not copyable"});
+    f.Gather(base, stride, count, out);
+    return {};
+  }
+
+  std::expected<void, Error> Field::Scatter(void *base, NGIN::UIntSize stride, NGIN::UIntSize count, const void *in) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsFieldAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
+    if (!f.Scatter)
+      return std::unexpected(Error{ErrorCode::NotFound, "field is not copyable"});
+    f.Scatter(base, stride, count, in);
+    return {};
+  }
+
   Any Field::GetAny(const void *obj) const
   {
     [[maybe_unused]] auto lock = detail::LockRegistryRead();
@@ -701,6 +1001,30 @@ namespace NGIN::Reflection
     return Any::MakeVoid();
   }
 
+  std::expected<ConstAnyView, Error> Field::GetView(const void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsFieldAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
+    if (!f.GetView)
+      return std::unexpected(Error{ErrorCode::NotFound, "field has no view"});
+    return f.GetView(obj);
+  }
+
+  std::expected<AnyView, Error> Field::GetMutView(void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsFieldAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
+    if (!f.GetMutView)
+      return std::unexpected(Error{ErrorCode::NotFound, "field has no view"});
+    return f.GetMutView(obj);
+  }
+
   std::expected<void, Error> Field::SetAny(void *obj, const Any &value) const
   {
     [[maybe_unused]] auto lock = detail::LockRegistryRead();
@@ -710,17 +1034,9 @@ namespace NGIN::Reflection
     const auto &f = reg.types[m_h.typeIndex].fields[m_h.fieldIndex];
     if (f.Store)
       return f.Store(obj, value);
-    if (value.GetTypeId() != f.typeId)
-    {
-      return std::unexpected(Error{ErrorCode::InvalidArgument, "type-id mismatch"});
-    }
-    void *dst = f.GetMut(obj);
-    if (value.Size() != f.sizeBytes)
-    {
-      return std::unexpected(Error{ErrorCode::InvalidArgument, "size mismatch"});
-    }
-    std::memcpy(dst, value.Data(), f.sizeBytes);
-    return {};
+    if (auto r = CheckFieldValue(f, value); !r.has_value())
+      return r;
+    return WriteFieldValue(f, obj, value);
   }
 
   NGIN::UIntSize Field::AttributeCount() const
@@ -798,6 +1114,39 @@ namespace NGIN::Reflection
     return p.Set(obj, value);
   }
 
+  bool Property::ReturnsReference() const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsPropertyAlive(reg, m_h))
+      return false;
+    return reg.types[m_h.typeIndex].properties[m_h.propertyIndex].GetView != nullptr;
+  }
+
+  std::expected<ConstAnyView, Error> Property::GetView(const void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsPropertyAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &p = reg.types[m_h.typeIndex].properties[m_h.propertyIndex];
+    if (!p.GetView)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "property getter does not return a reference"});
+    return p.GetView(obj);
+  }
+
+  std::expected<AnyView, Error> Property::GetMutView(void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsPropertyAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &p = reg.types[m_h.typeIndex].properties[m_h.propertyIndex];
+    if (!p.GetMutView)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "property getter does not return a mutable reference"});
+    return p.GetMutView(obj);
+  }
+
   NGIN::UIntSize Property::AttributeCount() const
   {
     [[maybe_unused]] auto lock = detail::LockRegistryRead();
@@ -886,6 +1235,39 @@ namespace NGIN::Reflection
     return reg.types[m_typeIndex].methods[m_methodIndex].Invoke(obj, args, count);
   }
 
+  bool Method::ReturnsReference() const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsMethodAlive(reg, m_typeIndex, m_typeGeneration, m_methodIndex))
+      return false;
+    return reg.types[m_typeIndex].methods[m_methodIndex].InvokeView != nullptr;
+  }
+
+  std::expected<ConstAnyView, Error> Method::InvokeView(void *obj, const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsMethodAlive(reg, m_typeIndex, m_typeGeneration, m_methodIndex))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &m = reg.types[m_typeIndex].methods[m_methodIndex];
+    if (!m.InvokeView)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "method does not return a reference"});
+    return m.InvokeView(obj, args, count);
+  }
+
+  std::expected<AnyView, Error> Method::InvokeMutView(void *obj, const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsMethodAlive(reg, m_typeIndex, m_typeGeneration, m_methodIndex))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &m = reg.types[m_typeIndex].methods[m_methodIndex];
+    if (!m.InvokeMutView)
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "method does not return a mutable reference"});
+    return m.InvokeMutView(obj, args, count);
+  }
+
   // span-based convenience overloads are defined inline in the header
 
   NGIN::UIntSize Method::AttributeCount() const
@@ -1011,6 +1393,18 @@ namespace NGIN::Reflection
     return c.Construct(args, count);
   }
 
+  std::expected<void, Error> Constructor::ConstructAt(void *storage, const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsCtorAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &c = reg.types[m_h.typeIndex].constructors[m_h.ctorIndex];
+    if (!c.ConstructAt)
+      return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+    return c.ConstructAt(storage, args, count, nullptr);
+  }
+
   NGIN::UIntSize Constructor::AttributeCount() const
   {
     [[maybe_unused]] auto lock = detail::LockRegistryRead();
@@ -1151,6 +1545,10 @@ namespace NGIN::Reflection
 
   bool UnregisterModule(ModuleId moduleId)
   {
+    // Pooled objects run the module's destructors, so release them before its types go, and
+    // before taking the write lock so those destructors may use the registry.
+    detail::ReleaseModulePools(moduleId);
+
     [[maybe_unused]] auto lock = detail::LockRegistryWrite();
     auto &reg = GetRegistry();
     bool removed = false;
@@ -1200,7 +1598,20 @@ namespace NGIN::Reflection
               ++k;
           }
           if (vec->Size() == 0)
+          {
             reg.functionOverloads.Remove(f.nameId);
+            reg.functionDispatch.Remove(f.nameId);
+          }
+          else
+          {
+            detail::OverloadDispatch dispatch{};
+            for (NGIN::UIntSize k = 0; k < vec->Size(); ++k)
+            {
+              const auto &g = reg.functions[(*vec)[k]];
+              detail::AddOverload(dispatch, (*vec)[k], g.paramTypeIds, g.signatureHash);
+            }
+            reg.functionDispatch.Insert(f.nameId, std::move(dispatch));
+          }
         }
       }
       f.name = {};
@@ -1210,6 +1621,7 @@ namespace NGIN::Reflection
       f.attributes.Clear();
       f.Invoke = nullptr;
       f.InvokeExact = nullptr;
+      f.InvokeConverted = nullptr;
       f.moduleId = 0;
       f.alive = false;
     }
@@ -1240,8 +1652,13 @@ namespace NGIN::Reflection
       detail::DecrementModuleTypeCount(moduleId);
     }
 
+    detail::RemoveModuleConversions(moduleId);
+
     if (removed)
+    {
+      detail::BumpRegistryEpoch();
       detail::FinishModuleInitialization(moduleId, false);
+    }
     return removed;
   }
 
@@ -1366,7 +1783,13 @@ namespace NGIN::Reflection
     auto h = NumInfoFromTid(have);
     auto w = NumInfoFromTid(want);
     if (h.kind == NumKind::None || w.kind == NumKind::None)
+    {
+      // User-defined conversions rank below every arithmetic conversion.
+      int cost = 0;
+      if (detail::FindUserConversion(have, want, cost))
+        return {5 + cost, 0, 1};
       return {1000, 0, 0};
+    }
     // Promotions: same kind, rank increases
     if (h.kind == w.kind && h.rank <= w.rank)
       return {1, 0, 0};
@@ -1391,239 +1814,202 @@ namespace NGIN::Reflection
     return {3, 0, 1};
   }
 
-  std::expected<ResolvedMethod, Error> Type::ResolveMethod(std::string_view name, const Any *args, NGIN::UIntSize count) const
+  // Score one argument. Views are scored by the type of the object they refer to;
+  // out-params (non-const T&) only accept a mutable view of exactly the parameter type.
+  static inline ScoreDims ArgScore(const Any &arg, NGIN::UInt64 want, NGIN::UInt64 outParamMask, NGIN::UIntSize i)
   {
-    [[maybe_unused]] auto lock = detail::LockRegistryRead();
-    const auto &reg = GetRegistry();
-    if (!IsTypeAlive(reg, m_h))
-      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
-    const auto &tdesc = reg.types[m_h.index];
-    NameId nid{};
-    (void)detail::FindNameId(name, nid);
-    auto *vec = tdesc.methodOverloads.GetPtr(nid);
-    if (!vec)
-      return std::unexpected(Error{ErrorCode::NotFound, "no overloads"});
-    NGIN::UInt32 bestIdx = static_cast<NGIN::UInt32>(-1);
-    NGIN::UInt32 closestIdx = static_cast<NGIN::UInt32>(-1);
-    int closestScore = INT_MAX;
-    struct Key
+    const auto have = detail::ArgTypeId(arg);
+    if (i < 64 && ((outParamMask >> i) & 1u) != 0)
+      return (detail::ArgIsMutableView(arg) && have == want) ? ScoreDims{0, 0, 0} : ScoreDims{1000, 0, 0};
+    return ParamScore(have, want);
+  }
+
+  // All arguments bind exactly (out-params through a mutable view).
+  template <class Desc>
+  static bool IsExactCall(const Desc &d, const Any *args, NGIN::UIntSize count)
+  {
+    for (NGIN::UIntSize i = 0; i < count; ++i)
     {
-      int total;
-      int nar;
-      int conv;
-      NGIN::UInt32 idx;
-    };
-    Key best{INT_MAX, INT_MAX, INT_MAX, 0};
-    NGIN::Containers::Vector<OverloadDiagnostic> diags;
-    diags.Reserve(vec->Size());
-    for (NGIN::UIntSize k = 0; k < vec->Size(); ++k)
+      if (ArgScore(args[i], d.paramTypeIds[i], d.outParamMask, i).cost != 0)
+        return false;
+    }
+    return true;
+  }
+
+  // Best overload of the arity bucket by (cost, narrowing, conversions, registration order).
+  // `descOf(index)` returns the candidate descriptor, or nullptr to skip it.
+  template <class DescOf>
+  static NGIN::UInt32 ScoreOverloads(const NGIN::Containers::Vector<NGIN::UInt32> &bucket, const Any *args,
+                                     NGIN::UIntSize count, DescOf &&descOf)
+  {
+    NGIN::UInt32 bestIdx = static_cast<NGIN::UInt32>(-1);
+    std::tuple<int, int, int> best{INT_MAX, INT_MAX, INT_MAX};
+    for (NGIN::UIntSize k = 0; k < bucket.Size(); ++k)
     {
-      auto mi = (*vec)[k];
-      const auto &m = tdesc.methods[mi];
-      OverloadDiagnostic diag{};
-      diag.methodIndex = mi;
-      diag.name = m.name;
-      diag.arity = m.paramTypeIds.Size();
-      if (m.paramTypeIds.Size() != count)
-      {
-        diag.code = DiagnosticCode::ArityMismatch;
-        auto diff = m.paramTypeIds.Size() > count ? m.paramTypeIds.Size() - count : count - m.paramTypeIds.Size();
-        diag.totalCost = 10000 + static_cast<int>(diff);
-        if (diag.totalCost < closestScore)
-        {
-          closestScore = diag.totalCost;
-          closestIdx = mi;
-        }
-        diags.PushBack(std::move(diag));
+      const auto *d = descOf(bucket[k]);
+      if (!d)
         continue;
-      }
       int total = 0;
       int nar = 0;
       int conv = 0;
       bool ok = true;
       for (NGIN::UIntSize i = 0; i < count; ++i)
       {
-        auto want = m.paramTypeIds[i];
-        auto have = args[i].GetTypeId();
-        auto d = ParamScore(have, want);
-        if (d.cost >= 1000)
+        auto sc = ArgScore(args[i], d->paramTypeIds[i], d->outParamMask, i);
+        if (sc.cost >= 1000)
         {
           ok = false;
-          diag.code = DiagnosticCode::NonConvertible;
-          diag.argIndex = i;
-          diag.totalCost = 20000 + static_cast<int>(i);
           break;
         }
-        total += d.cost;
-        nar += d.narrow;
-        conv += d.conv;
+        total += sc.cost;
+        nar += sc.narrow;
+        conv += sc.conv;
       }
-      if (ok)
+      if (ok && std::tuple{total, nar, conv} < best)
       {
-        diag.code = DiagnosticCode::None;
-        diag.totalCost = total;
-        diag.narrow = nar;
-        diag.conversions = conv;
-        Key cur{total, nar, conv, static_cast<NGIN::UInt32>(k)};
-        if (std::tuple{cur.total, cur.nar, cur.conv, cur.idx} < std::tuple{best.total, best.nar, best.conv, best.idx})
-        {
-          best = cur;
-          bestIdx = mi;
-        }
+        best = {total, nar, conv};
+        bestIdx = bucket[k];
       }
-      if (diag.code == DiagnosticCode::None && diag.totalCost < closestScore)
-      {
-        closestScore = diag.totalCost;
-        closestIdx = mi;
-      }
-      if (diag.code == DiagnosticCode::NonConvertible && diag.totalCost < closestScore)
-      {
-        closestScore = diag.totalCost;
-        closestIdx = mi;
-      }
-      diags.PushBack(std::move(diag));
-    }
-    if (bestIdx == static_cast<NGIN::UInt32>(-1))
-    {
-      Error err{ErrorCode::InvalidArgument, "no viable overload", std::move(diags)};
-      if (closestIdx != static_cast<NGIN::UInt32>(-1))
-        err.closestMethodIndex = closestIdx;
-      return std::unexpected(std::move(err));
     }
-    NGIN::Containers::Vector<NGIN::UInt64> argTypeIds;
-    NGIN::Containers::Vector<detail::ConversionKind> conversions;
-    if (count > 0)
+    return bestIdx;
+  }
+
+  // Exact-signature lookup first, then scoring over the candidates of matching arity only.
+  template <class DescOf>
+  static NGIN::UInt32 PickOverload(const detail::OverloadDispatch &dispatch, const Any *args, NGIN::UIntSize count,
+                                   DescOf &&descOf)
+  {
+    if (count >= dispatch.byArity.Size() || dispatch.byArity[count].Size() == 0)
+      return static_cast<NGIN::UInt32>(-1);
+    if (const auto *idx = dispatch.exact.GetPtr(detail::ArgSignatureHash(args, count)))
     {
-      argTypeIds.Reserve(count);
-      conversions.Reserve(count);
-      const auto &m = tdesc.methods[bestIdx];
-      for (NGIN::UIntSize i = 0; i < count; ++i)
-      {
-        argTypeIds.PushBack(args[i].GetTypeId());
-        conversions.PushBack(args[i].GetTypeId() == m.paramTypeIds[i] ? detail::ConversionKind::Exact
-                                                                      : detail::ConversionKind::Convert);
-      }
+      const auto *d = descOf(*idx);
+      if (d && d->paramTypeIds.Size() == count && IsExactCall(*d, args, count))
+        return *idx;
     }
-    return ResolvedMethod{m_h.index, m_h.generation, bestIdx, std::move(argTypeIds), std::move(conversions)};
+    return ScoreOverloads(dispatch.byArity[count], args, count, descOf);
   }
 
-  std::expected<ResolvedFunction, Error> ResolveFunction(std::string_view name, const Any *args, NGIN::UIntSize count)
+  // Failure path: find the closest candidate and, if requested, explain every candidate.
+  template <class DescOf>
+  static Error OverloadFailure(const NGIN::Containers::Vector<NGIN::UInt32> &candidates, const Any *args,
+                               NGIN::UIntSize count, DescOf &&descOf, bool collectDiagnostics)
   {
-    [[maybe_unused]] auto lock = detail::LockRegistryRead();
-    const auto &reg = GetRegistry();
-    NameId nid{};
-    (void)detail::FindNameId(name, nid);
-    auto *vec = reg.functionOverloads.GetPtr(nid);
-    if (!vec)
-      return std::unexpected(Error{ErrorCode::NotFound, "no overloads"});
-    NGIN::UInt32 bestIdx = static_cast<NGIN::UInt32>(-1);
-    NGIN::UInt32 closestIdx = static_cast<NGIN::UInt32>(-1);
+    Error err{ErrorCode::InvalidArgument, "no viable overload"};
     int closestScore = INT_MAX;
-    struct Key
-    {
-      int total;
-      int nar;
-      int conv;
-      NGIN::UInt32 idx;
-    };
-    Key best{INT_MAX, INT_MAX, INT_MAX, 0};
-    NGIN::Containers::Vector<OverloadDiagnostic> diags;
-    diags.Reserve(vec->Size());
-    bool anyAlive = false;
-    for (NGIN::UIntSize k = 0; k < vec->Size(); ++k)
+    if (collectDiagnostics)
+      err.diagnostics.Reserve(candidates.Size());
+    for (NGIN::UIntSize k = 0; k < candidates.Size(); ++k)
     {
-      auto fi = (*vec)[k];
-      if (!detail::IsFunctionAlive(reg, FunctionHandle{fi}))
+      const auto idx = candidates[k];
+      const auto *d = descOf(idx);
+      if (!d)
         continue;
-      anyAlive = true;
-      const auto &f = reg.functions[fi];
       OverloadDiagnostic diag{};
-      diag.methodIndex = fi;
-      diag.name = f.name;
-      diag.arity = f.paramTypeIds.Size();
-      if (f.paramTypeIds.Size() != count)
+      diag.methodIndex = idx;
+      diag.name = d->name;
+      diag.arity = d->paramTypeIds.Size();
+      if (d->paramTypeIds.Size() != count)
       {
         diag.code = DiagnosticCode::ArityMismatch;
-        auto diff = f.paramTypeIds.Size() > count ? f.paramTypeIds.Size() - count : count - f.paramTypeIds.Size();
+        auto diff = d->paramTypeIds.Size() > count ? d->paramTypeIds.Size() - count : count - d->paramTypeIds.Size();
         diag.totalCost = 10000 + static_cast<int>(diff);
-        if (diag.totalCost < closestScore)
-        {
-          closestScore = diag.totalCost;
-          closestIdx = fi;
-        }
-        diags.PushBack(std::move(diag));
-        continue;
       }
-      int total = 0;
-      int nar = 0;
-      int conv = 0;
-      bool ok = true;
-      for (NGIN::UIntSize i = 0; i < count; ++i)
+      else
       {
-        auto want = f.paramTypeIds[i];
-        auto have = args[i].GetTypeId();
-        auto d = ParamScore(have, want);
-        if (d.cost >= 1000)
+        for (NGIN::UIntSize i = 0; i < count; ++i)
         {
-          ok = false;
-          diag.code = DiagnosticCode::NonConvertible;
-          diag.argIndex = i;
-          diag.totalCost = 20000 + static_cast<int>(i);
-          break;
-        }
-        total += d.cost;
-        nar += d.narrow;
-        conv += d.conv;
-      }
-      if (ok)
-      {
-        diag.code = DiagnosticCode::None;
-        diag.totalCost = total;
-        diag.narrow = nar;
-        diag.conversions = conv;
-        Key cur{total, nar, conv, static_cast<NGIN::UInt32>(k)};
-        if (std::tuple{cur.total, cur.nar, cur.conv, cur.idx} < std::tuple{best.total, best.nar, best.conv, best.idx})
-        {
-          best = cur;
-          bestIdx = fi;
+          auto sc = ArgScore(args[i], d->paramTypeIds[i], d->outParamMask, i);
+          if (sc.cost >= 1000)
+          {
+            diag.code = DiagnosticCode::NonConvertible;
+            diag.argIndex = i;
+            diag.totalCost = 20000 + static_cast<int>(i);
+            diag.narrow = 0;
+            diag.conversions = 0;
+            break;
+          }
+          diag.totalCost += sc.cost;
+          diag.narrow += sc.narrow;
+          diag.conversions += sc.conv;
         }
       }
-      if (diag.code == DiagnosticCode::None && diag.totalCost < closestScore)
+      ++err.candidateCount;
+      if (diag.totalCost < closestScore)
       {
         closestScore = diag.totalCost;
-        closestIdx = fi;
+        err.closestMethodIndex = idx;
+        err.reason = diag.code;
+        err.argIndex = diag.argIndex;
       }
-      if (diag.code == DiagnosticCode::NonConvertible && diag.totalCost < closestScore)
-      {
-        closestScore = diag.totalCost;
-        closestIdx = fi;
-      }
-      diags.PushBack(std::move(diag));
+      if (collectDiagnostics)
+        err.diagnostics.PushBack(std::move(diag));
     }
-    if (!anyAlive)
+    return err;
+  }
+
+  std::expected<ResolvedMethod, Error> Type::ResolveMethod(std::string_view name, const Any *args, NGIN::UIntSize count,
+                                                           ResolveOptions options) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    detail::ArgPlan plan{};
+    NGIN::UInt32 cached{};
+    if (detail::FindCachedOverload(detail::ResolveKind::Method, m_h, name, args, count, cached))
+    {
+      plan.Build(tdesc.methods[cached].paramTypeIds, args, count);
+      return ResolvedMethod{m_h.index, m_h.generation, cached, std::move(plan)};
+    }
+    NameId nid{};
+    (void)detail::FindNameId(name, nid);
+    const auto *dispatch = tdesc.methodDispatch.GetPtr(nid);
+    if (!dispatch)
       return std::unexpected(Error{ErrorCode::NotFound, "no overloads"});
+    auto descOf = [&](NGIN::UInt32 mi) { return &tdesc.methods[mi]; };
+    const auto bestIdx = PickOverload(*dispatch, args, count, descOf);
     if (bestIdx == static_cast<NGIN::UInt32>(-1))
+      return std::unexpected(OverloadFailure(*tdesc.methodOverloads.GetPtr(nid), args, count, descOf, options.collectDiagnostics));
+    detail::StoreCachedOverload(detail::ResolveKind::Method, m_h, tdesc.methods[bestIdx].name, args, count, bestIdx);
+    plan.Build(tdesc.methods[bestIdx].paramTypeIds, args, count);
+    return ResolvedMethod{m_h.index, m_h.generation, bestIdx, std::move(plan)};
+  }
+
+  std::expected<ResolvedFunction, Error> ResolveFunction(std::string_view name, const Any *args, NGIN::UIntSize count,
+                                                         ResolveOptions options)
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    detail::ArgPlan plan{};
+    NGIN::UInt32 cached{};
+    if (detail::FindCachedOverload(detail::ResolveKind::Function, TypeHandle{}, name, args, count, cached))
     {
-      Error err{ErrorCode::InvalidArgument, "no viable overload", std::move(diags)};
-      if (closestIdx != static_cast<NGIN::UInt32>(-1))
-        err.closestMethodIndex = closestIdx;
-      return std::unexpected(std::move(err));
+      plan.Build(reg.functions[cached].paramTypeIds, args, count);
+      return ResolvedFunction{cached, std::move(plan)};
     }
-    NGIN::Containers::Vector<NGIN::UInt64> argTypeIds;
-    NGIN::Containers::Vector<detail::ConversionKind> conversions;
-    if (count > 0)
+    NameId nid{};
+    (void)detail::FindNameId(name, nid);
+    const auto *dispatch = reg.functionDispatch.GetPtr(nid);
+    const auto *vec = reg.functionOverloads.GetPtr(nid);
+    if (!dispatch || !vec)
+      return std::unexpected(Error{ErrorCode::NotFound, "no overloads"});
+    auto descOf = [&](NGIN::UInt32 fi) -> const detail::FunctionDescriptor *
+    { return detail::IsFunctionAlive(reg, FunctionHandle{fi}) ? &reg.functions[fi] : nullptr; };
+    const auto bestIdx = PickOverload(*dispatch, args, count, descOf);
+    if (bestIdx == static_cast<NGIN::UInt32>(-1))
     {
-      argTypeIds.Reserve(count);
-      conversions.Reserve(count);
-      const auto &f = reg.functions[bestIdx];
-      for (NGIN::UIntSize i = 0; i < count; ++i)
-      {
-        argTypeIds.PushBack(args[i].GetTypeId());
-        conversions.PushBack(args[i].GetTypeId() == f.paramTypeIds[i] ? detail::ConversionKind::Exact
-                                                                      : detail::ConversionKind::Convert);
-      }
+      bool anyAlive = false;
+      for (NGIN::UIntSize k = 0; k < vec->Size() && !anyAlive; ++k)
+        anyAlive = descOf((*vec)[k]) != nullptr;
+      if (!anyAlive)
+        return std::unexpected(Error{ErrorCode::NotFound, "no overloads"});
+      return std::unexpected(OverloadFailure(*vec, args, count, descOf, options.collectDiagnostics));
     }
-    return ResolvedFunction{bestIdx, std::move(argTypeIds), std::move(conversions)};
+    detail::StoreCachedOverload(detail::ResolveKind::Function, TypeHandle{}, reg.functions[bestIdx].name, args, count, bestIdx);
+    plan.Build(reg.functions[bestIdx].paramTypeIds, args, count);
+    return ResolvedFunction{bestIdx, std::move(plan)};
   }
 
   // Constructors
@@ -1645,35 +2031,41 @@ namespace NGIN::Reflection
     return Constructor{ConstructorHandle{m_h.index, static_cast<NGIN::UInt32>(i), m_h.generation}};
   }
 
-  std::expected<Any, Error> Type::Construct(const Any *args, NGIN::UIntSize count) const
+  // Exact calls use the exact thunk; converting arguments go through per-argument
+  // converters (user-defined conversions included).
+  static std::expected<Any, Error> ConstructWith(const detail::ConstructorDescriptor &c, const Any *args, NGIN::UIntSize count)
+  {
+    if (IsExactCall(c, args, count))
+      return c.ConstructExact ? c.ConstructExact(args, count) : c.Construct(args, count);
+    if (!c.ConstructConverted)
+      return c.Construct(args, count);
+    detail::ArgPlan plan{};
+    plan.Build(c.paramTypeIds, args, count);
+    if (!plan.HasAllConverters())
+      return c.Construct(args, count);
+    return c.ConstructConverted(args, count, plan.Converters());
+  }
+
+  // Best constructor for the arguments (same scoring as methods, memoized), or -1.
+  static NGIN::UInt32 PickConstructor(TypeHandle h, const detail::TypeDescriptor &tdesc, const Any *args, NGIN::UIntSize count)
   {
-    [[maybe_unused]] auto lock = detail::LockRegistryRead();
-    const auto &reg = GetRegistry();
-    if (!IsTypeAlive(reg, m_h))
-      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
-    const auto &tdesc = reg.types[m_h.index];
-    // Fast-path: default constructor
     if (count == 0)
     {
       for (NGIN::UIntSize i = 0; i < tdesc.constructors.Size(); ++i)
       {
         const auto &c = tdesc.constructors[i];
-        if (c.paramTypeIds.Size() == 0 && c.Construct)
-          return c.Construct(nullptr, 0);
+        if (c.paramTypeIds.Size() == 0)
+          return static_cast<NGIN::UInt32>(i);
       }
-      return std::unexpected(Error{ErrorCode::NotFound, "no default constructor"});
+      return static_cast<NGIN::UInt32>(-1);
     }
 
-    // Overload selection (same scoring as methods)
+    NGIN::UInt32 cached{};
+    if (detail::FindCachedOverload(detail::ResolveKind::Constructor, h, {}, args, count, cached))
+      return cached;
+
     NGIN::UInt32 bestIdx = static_cast<NGIN::UInt32>(-1);
-    struct Key
-    {
-      int total;
-      int nar;
-      int conv;
-      NGIN::UInt32 idx;
-    };
-    Key best{INT_MAX, INT_MAX, INT_MAX, 0};
+    std::tuple<int, int, int> best{INT_MAX, INT_MAX, INT_MAX};
     for (NGIN::UIntSize i = 0; i < tdesc.constructors.Size(); ++i)
     {
       const auto &c = tdesc.constructors[i];
@@ -1685,9 +2077,7 @@ namespace NGIN::Reflection
       bool ok = true;
       for (NGIN::UIntSize k = 0; k < count; ++k)
       {
-        auto want = c.paramTypeIds[k];
-        auto have = args[k].GetTypeId();
-        auto d = ParamScore(have, want);
+        auto d = ArgScore(args[k], c.paramTypeIds[k], c.outParamMask, k);
         if (d.cost >= 1000)
         {
           ok = false;
@@ -1697,19 +2087,183 @@ namespace NGIN::Reflection
         nar += d.narrow;
         conv += d.conv;
       }
-      if (ok)
+      if (ok && std::tuple{total, nar, conv} < best)
       {
-        Key cur{total, nar, conv, static_cast<NGIN::UInt32>(i)};
-        if (std::tuple{cur.total, cur.nar, cur.conv, cur.idx} < std::tuple{best.total, best.nar, best.conv, best.idx})
+        best = {total, nar, conv};
+        bestIdx = static_cast<NGIN::UInt32>(i);
+      }
+    }
+    if (bestIdx != static_cast<NGIN::UInt32>(-1))
+      detail::StoreCachedOverload(detail::ResolveKind::Constructor, h, {}, args, count, bestIdx);
+    return bestIdx;
+  }
+
+  std::expected<Any, Error> Type::Construct(const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    const auto idx = PickConstructor(m_h, tdesc, args, count);
+    if (idx == static_cast<NGIN::UInt32>(-1))
+    {
+      if (count == 0)
+        return std::unexpected(Error{ErrorCode::NotFound, "no default constructor"});
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "no viable constructor"});
+    }
+    if (!tdesc.constructors[idx].Construct)
+      return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+    return ConstructWith(tdesc.constructors[idx], args, count);
+  }
+
+  std::expected<void, Error> Type::ConstructAt(void *storage, const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    const auto idx = PickConstructor(m_h, tdesc, args, count);
+    if (idx == static_cast<NGIN::UInt32>(-1))
+    {
+      if (count == 0)
+        return std::unexpected(Error{ErrorCode::NotFound, "no default constructor"});
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "no viable constructor"});
+    }
+    const auto &c = tdesc.constructors[idx];
+    if (!c.ConstructAt)
+      return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+    if (IsExactCall(c, args, count))
+      return c.ConstructAt(storage, args, count, nullptr);
+    detail::ArgPlan plan{};
+    plan.Build(c.paramTypeIds, args, count);
+    return c.ConstructAt(storage, args, count, plan.HasAllConverters() ? plan.Converters() : nullptr);
+  }
+
+  std::expected<void, Error> Type::Destroy(void *obj) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    if (!tdesc.Destroy)
+      return std::unexpected(Error{ErrorCode::NotFound, "type is not destructible"});
+    tdesc.Destroy(obj);
+    return {};
+  }
+
+  std::expected<void, Error> Type::ConstructArray(void *dst, NGIN::UIntSize n, const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    const auto idx = PickConstructor(m_h, tdesc, args, count);
+    if (idx == static_cast<NGIN::UInt32>(-1))
+    {
+      if (count == 0)
+        return std::unexpected(Error{ErrorCode::NotFound, "no default constructor"});
+      return std::unexpected(Error{ErrorCode::InvalidArgument, "no viable constructor"});
+    }
+    const auto &c = tdesc.constructors[idx];
+    if (!c.ConstructAt)
+      return std::unexpected(Error{ErrorCode::NotFound, "constructor not available"});
+    if (n == 0)
+      return {};
+    const detail::ArgConverter *converters = nullptr;
+    detail::ArgPlan plan{};
+    if (!IsExactCall(c, args, count))
+    {
+      plan.Build(c.paramTypeIds, args, count);
+      converters = plan.HasAllConverters() ? plan.Converters() : nullptr;
+    }
+    if (c.ConstructArray)
+      return c.ConstructArray(dst, n, args, count, converters);
+
+    // Rvalue-only parameters cannot be shared across elements: bind them per element.
+    auto *bytes = static_cast<unsigned char *>(dst);
+    NGIN::UIntSize i = 0;
+    try
+    {
+      for (; i < n; ++i)
+      {
+        auto r = c.ConstructAt(bytes + i * tdesc.sizeBytes, args, count, converters);
+        if (!r.has_value())
         {
-          best = cur;
-          bestIdx = static_cast<NGIN::UInt32>(i);
+          if (tdesc.DestroyArray)
+            tdesc.DestroyArray(dst, i);
+          return r;
         }
       }
     }
-    if (bestIdx == static_cast<NGIN::UInt32>(-1))
+    catch (...)
+    {
+      if (tdesc.DestroyArray)
+        tdesc.DestroyArray(dst, i);
+      throw;
+    }
+    return {};
+  }
+
+  std::expected<void, Error> Type::DestroyArray(void *dst, NGIN::UIntSize n) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    if (!tdesc.DestroyArray)
+      return std::unexpected(Error{ErrorCode::NotFound, "type is not destructible"});
+    tdesc.DestroyArray(dst, n);
+    return {};
+  }
+
+  std::expected<void, Error> Type::MoveConstruct(void *dst, void *src) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    if (!tdesc.MoveConstruct)
+      return std::unexpected(Error{ErrorCode::NotFound, "type is not move constructible"});
+    tdesc.MoveConstruct(dst, src);
+    return {};
+  }
+
+  std::expected<void, Error> Type::CopyConstruct(void *dst, const void *src) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    if (!tdesc.CopyConstruct)
+      return std::unexpected(Error{ErrorCode::NotFound, "type is not copy constructible"});
+    tdesc.CopyConstruct(dst, src);
+    return {};
+  }
+
+  std::expected<ResolvedConstructor, Error> Type::ResolveConstructor(const Any *args, NGIN::UIntSize count) const
+  {
+    [[maybe_unused]] auto lock = detail::LockRegistryRead();
+    const auto &reg = GetRegistry();
+    if (!IsTypeAlive(reg, m_h))
+      return std::unexpected(Error{ErrorCode::InvalidArgument, kStaleHandle});
+    const auto &tdesc = reg.types[m_h.index];
+    const auto idx = PickConstructor(m_h, tdesc, args, count);
+    if (idx == static_cast<NGIN::UInt32>(-1))
+    {
+      if (count == 0)
+        return std::unexpected(Error{ErrorCode::NotFound, "no default constructor"});
       return std::unexpected(Error{ErrorCode::InvalidArgument, "no viable constructor"});
-    return tdesc.constructors[bestIdx].Construct(args, count);
+    }
+    detail::ArgPlan plan{};
+    plan.Build(tdesc.constructors[idx].paramTypeIds, args, count);
+    return ResolvedConstructor{ConstructorHandle{m_h.index, idx, m_h.generation}, std::move(plan)};
   }
 
   NGIN::UIntSize Type::AttributeCount() const
@@ -0,0 +1,157 @@
+#include <NGIN/Reflection/Registry.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <shared_mutex>
+
+namespace NGIN::Reflection::detail
+{
+  namespace
+  {
+    constexpr NGIN::UIntSize kMaxCachedArgs = 8;
+    constexpr NGIN::UIntSize kShardCount = 16;
+    // A shard that grows past this is cleared on the next store; stale entries from old
+    // epochs are only ever overwritten or dropped this way.
+    constexpr NGIN::UIntSize kMaxEntriesPerShard = 1024;
+
+    struct CacheEntry
+    {
+      NGIN::UInt64 epoch{0};
+      ResolveKind kind{ResolveKind::Method};
+      TypeHandle owner{};
+      std::string_view name{};
+      NGIN::UInt32 argCount{0};
+      NGIN::UInt32 mutableViewMask{0}; // out-params only accept mutable views, so this is part of the key
+      std::array<NGIN::UInt64, kMaxCachedArgs> argTypeIds{};
+      NGIN::UInt32 index{0};
+    };
+
+    struct Shard
+    {
+      std::shared_mutex mutex;
+      NGIN::Containers::FlatHashMap<NGIN::UInt64, CacheEntry> entries;
+    };
+
+    std::array<Shard, kShardCount> g_shards{};
+    std::atomic<NGIN::UInt64> g_hits{0};
+    std::atomic<NGIN::UInt64> g_misses{0};
+
+    NGIN::UInt32 MutableViewMask(const Any *args, NGIN::UIntSize count) noexcept
+    {
+      NGIN::UInt32 mask = 0;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        if (ArgIsMutableView(args[i]))
+          mask |= 1u << i;
+      }
+      return mask;
+    }
+
+    inline NGIN::UInt64 Mix(NGIN::UInt64 h, NGIN::UInt64 v) noexcept
+    {
+      h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+      return h;
+    }
+
+    NGIN::UInt64 KeyHash(ResolveKind kind, TypeHandle owner, std::string_view name,
+                         const Any *args, NGIN::UIntSize count) noexcept
+    {
+      auto h = NGIN::Hashing::FNV1a64(name.data(), name.size());
+      h = Mix(h, static_cast<NGIN::UInt64>(kind));
+      h = Mix(h, (static_cast<NGIN::UInt64>(owner.index) << 32) | owner.generation);
+      h = Mix(h, count);
+      h = Mix(h, MutableViewMask(args, count));
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+        h = Mix(h, ArgTypeId(args[i]));
+      return h;
+    }
+
+    bool SameKey(const CacheEntry &e, ResolveKind kind, TypeHandle owner, std::string_view name,
+                 const Any *args, NGIN::UIntSize count) noexcept
+    {
+      if (e.kind != kind || e.owner.index != owner.index || e.owner.generation != owner.generation ||
+          e.argCount != count || e.name.size() != name.size() || e.mutableViewMask != MutableViewMask(args, count))
+        return false;
+      for (NGIN::UIntSize i = 0; i < count; ++i)
+      {
+        if (e.argTypeIds[i] != ArgTypeId(args[i]))
+          return false;
+      }
+      return name.empty() || std::memcmp(e.name.data(), name.data(), name.size()) == 0;
+    }
+  } // namespace
+
+  bool FindCachedOverload(ResolveKind kind, TypeHandle owner, std::string_view name,
+                          const Any *args, NGIN::UIntSize count, NGIN::UInt32 &outIndex) noexcept
+  {
+    if (count > kMaxCachedArgs)
+      return false;
+    const auto h = KeyHash(kind, owner, name, args, count);
+    auto &shard = g_shards[h % kShardCount];
+    {
+      std::shared_lock lock{shard.mutex};
+      // Stale entries are checked by epoch first: their name may point into an unloaded module.
+      const auto *e = shard.entries.GetPtr(h);
+      if (e && e->epoch == RegistryEpoch() && SameKey(*e, kind, owner, name, args, count))
+      {
+        outIndex = e->index;
+        g_hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    g_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  void StoreCachedOverload(ResolveKind kind, TypeHandle owner, std::string_view name,
+                           const Any *args, NGIN::UIntSize count, NGIN::UInt32 index) noexcept
+  {
+    if (count > kMaxCachedArgs)
+      return;
+    CacheEntry e{};
+    e.epoch = RegistryEpoch();
+    e.kind = kind;
+    e.owner = owner;
+    e.name = name;
+    e.argCount = static_cast<NGIN::UInt32>(count);
+    e.mutableViewMask = MutableViewMask(args, count);
+    for (NGIN::UIntSize i = 0; i < count; ++i)
+      e.argTypeIds[i] = ArgTypeId(args[i]);
+    e.index = index;
+
+    const auto h = KeyHash(kind, owner, name, args, count);
+    auto &shard = g_shards[h % kShardCount];
+    std::unique_lock lock{shard.mutex};
+    if (shard.entries.Size() >= kMaxEntriesPerShard)
+      shard.entries.Clear();
+    shard.entries.Insert(h, e);
+  }
+} // namespace NGIN::Reflection::detail
+
+namespace NGIN::Reflection
+{
+  ResolutionCacheStats GetResolutionCacheStats() noexcept
+  {
+    ResolutionCacheStats stats{};
+    stats.hits = detail::g_hits.load(std::memory_order_relaxed);
+    stats.misses = detail::g_misses.load(std::memory_order_relaxed);
+    for (auto &shard : detail::g_shards)
+    {
+      std::shared_lock lock{shard.mutex};
+      stats.entries += shard.entries.Size();
+    }
+    return stats;
+  }
+
+  void ClearResolutionCache() noexcept
+  {
+    for (auto &shard : detail::g_shards)
+    {
+      std::unique_lock lock{shard.mutex};
+      shard.entries.Clear();
+    }
+    detail::g_hits.store(0, std::memory_order_relaxed);
+    detail::g_misses.store(0, std::memory_order_relaxed);
+  }
+} // namespace NGIN::Reflection
@@ -0,0 +1,71 @@
+// AnyArena.cpp - AnyArenaScope routing of Any heap spills
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <array>
+
+namespace ArenaDemo
+{
+  // Larger than any sensible Any small buffer, so every boxed copy spills.
+  struct Blob
+  {
+    std::array<float, 64> data{};
+  };
+
+  struct Holder
+  {
+    Blob blob{};
+    Blob Make() const { return blob; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Holder>, NGIN::Reflection::TypeBuilder<Holder> &b)
+    {
+      b.Field<&Holder::blob>("blob");
+      b.Method<&Holder::Make>("Make");
+    }
+  };
+} // namespace ArenaDemo
+
+TEST_CASE("AnyArenaScopeCapturesSpills", "[reflection][AnyArena]")
+{
+  using namespace NGIN::Reflection;
+  using ArenaDemo::Holder;
+
+  auto t = GetType<Holder>();
+  auto field = t.GetField("blob").value();
+  auto make = t.GetMethod("Make").value();
+  Holder h{};
+  h.blob.data[3] = 7.0f;
+
+  // Created on the system heap, destroyed inside a scope.
+  Any outside = field.GetAny(h);
+
+  ResetAnyArenaStats();
+  {
+    AnyArenaScope scope{};
+    for (int i = 0; i < 100; ++i)
+    {
+      auto v = field.GetAny(h);
+      CHECK(v.Cast<ArenaDemo::Blob>().data[3] == 7.0f);
+    }
+    const Any *noArgs = nullptr;
+    auto r = make.Invoke(&h, noArgs, 0);
+    REQUIRE(r.has_value());
+    CHECK(r->Cast<ArenaDemo::Blob>().data[3] == 7.0f);
+    CHECK(scope.BytesUsed() >= 101 * sizeof(ArenaDemo::Blob));
+
+    {
+      AnyArenaScope inner{256};
+      auto v = field.GetAny(h);
+      CHECK(inner.BytesUsed() >= sizeof(ArenaDemo::Blob));
+    }
+    outside = Any{};
+  }
+  auto stats = GetAnyArenaStats();
+  CHECK(stats.arenaAllocations >= 102);
+  CHECK(stats.heapAllocations == 0);
+
+  auto after = field.GetAny(h);
+  CHECK(GetAnyArenaStats().heapAllocations >= 1);
+}
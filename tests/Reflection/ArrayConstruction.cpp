@@ -0,0 +1,161 @@
+// ArrayConstruction.cpp - Type::ConstructArray / DestroyArray over contiguous storage
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace ArrayDemo
+{
+  struct Tile
+  {
+    static inline int alive = 0;
+
+    std::string material{"stone"};
+    int height{1};
+
+    Tile() { ++alive; }
+    Tile(std::string m, int h) : material(std::move(m)), height(h) { ++alive; }
+    Tile(const Tile &o) : material(o.material), height(o.height) { ++alive; }
+    Tile(Tile &&o) noexcept : material(std::move(o.material)), height(o.height) { ++alive; }
+    ~Tile() { --alive; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Tile>, NGIN::Reflection::TypeBuilder<Tile> &b)
+    {
+      b.Constructor<std::string, int>();
+    }
+  };
+
+  struct Cell
+  {
+    int x;
+    float weight;
+  };
+
+  struct Sink
+  {
+    std::string name;
+    Sink() = default;
+    explicit Sink(std::string &&n) : name(std::move(n)) {}
+
+    friend void NginReflect(NGIN::Reflection::Tag<Sink>, NGIN::Reflection::TypeBuilder<Sink> &b)
+    {
+      b.Constructor<std::string &&>();
+    }
+  };
+
+  struct Fragile
+  {
+    static inline int alive = 0;
+    static inline int budget = 0;
+
+    Fragile()
+    {
+      if (budget-- == 0)
+        throw std::runtime_error("out of budget");
+      ++alive;
+    }
+    Fragile(const Fragile &) { ++alive; }
+    ~Fragile() { --alive; }
+  };
+
+  struct MemberRef
+  {
+    int Cell::*member;
+  };
+} // namespace ArrayDemo
+
+TEST_CASE("ConstructArrayBindsArgumentsOnce", "[reflection][ArrayConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using ArrayDemo::Tile;
+
+  auto t = GetType<Tile>();
+  alignas(Tile) unsigned char storage[sizeof(Tile) * 5];
+  const int before = Tile::alive;
+
+  Any args[2] = {Any{std::string{"grass"}}, Any{3}};
+  REQUIRE(t.ConstructArray(storage, 5, args, 2).has_value());
+  CHECK(Tile::alive == before + 5);
+  auto *tiles = reinterpret_cast<Tile *>(storage);
+  for (int i = 0; i < 5; ++i)
+  {
+    CHECK(tiles[i].material == "grass");
+    CHECK(tiles[i].height == 3);
+  }
+  REQUIRE(t.DestroyArray(storage, 5).has_value());
+  CHECK(Tile::alive == before);
+
+  const Any *noArgs = nullptr;
+  REQUIRE(t.ConstructArray(storage, 2, noArgs, 0).has_value());
+  CHECK(tiles[1].material == "stone");
+  REQUIRE(t.DestroyArray(storage, 2).has_value());
+  CHECK(Tile::alive == before);
+
+  Any bad[1] = {Any{1}};
+  CHECK_FALSE(t.ConstructArray(storage, 2, bad, 1).has_value());
+  CHECK(Tile::alive == before);
+  CHECK(t.ConstructArray(storage, 0, args, 2).has_value());
+}
+
+TEST_CASE("ConstructArrayZeroFillsTrivialTypes", "[reflection][ArrayConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using ArrayDemo::Cell;
+
+  Cell cells[16];
+  std::memset(cells, 0xAB, sizeof(cells));
+  const Any *noArgs = nullptr;
+  REQUIRE(GetType<Cell>().ConstructArray(cells, 16, noArgs, 0).has_value());
+  for (const auto &c : cells)
+  {
+    CHECK(c.x == 0);
+    CHECK(c.weight == 0.0f);
+  }
+  CHECK(GetType<Cell>().DestroyArray(cells, 16).has_value());
+}
+
+TEST_CASE("ConstructArrayFallsBackForRvalueParameters", "[reflection][ArrayConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using ArrayDemo::Sink;
+
+  alignas(Sink) unsigned char storage[sizeof(Sink) * 3];
+  Any args[1] = {Any{std::string{"drain"}}};
+  REQUIRE(GetType<Sink>().ConstructArray(storage, 3, args, 1).has_value());
+  auto *sinks = reinterpret_cast<Sink *>(storage);
+  CHECK(sinks[0].name == "drain");
+  CHECK(sinks[2].name == "drain");
+  REQUIRE(GetType<Sink>().DestroyArray(storage, 3).has_value());
+}
+
+TEST_CASE("ConstructArrayUnwindsWhenAnElementThrows", "[reflection][ArrayConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using ArrayDemo::Fragile;
+
+  auto t = GetType<Fragile>();
+  alignas(Fragile) unsigned char storage[sizeof(Fragile) * 4];
+  Fragile::budget = 2;
+  const Any *noArgs = nullptr;
+  CHECK_THROWS_AS((void)t.ConstructArray(storage, 4, noArgs, 0), std::runtime_error);
+  CHECK(Fragile::alive == 0);
+}
+
+TEST_CASE("ConstructArrayValueInitializesMemberPointers", "[reflection][ArrayConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using ArrayDemo::MemberRef;
+
+  auto t = GetType<MemberRef>();
+  alignas(MemberRef) unsigned char storage[sizeof(MemberRef) * 3];
+  std::memset(storage, 0x5A, sizeof(storage));
+  const Any *noArgs = nullptr;
+  REQUIRE(t.ConstructArray(storage, 3, noArgs, 0).has_value());
+  const auto *refs = reinterpret_cast<const MemberRef *>(storage);
+  for (int i = 0; i < 3; ++i)
+    CHECK(refs[i].member == nullptr);
+}
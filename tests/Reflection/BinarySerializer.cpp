@@ -0,0 +1,142 @@
+// BinarySerializer.cpp - plan-compiled binary round trips
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SerializerDemo
+{
+  struct Stats
+  {
+    int strength{0};
+    int agility{0};
+    float speed{0.0f};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Stats>, NGIN::Reflection::TypeBuilder<Stats> &b)
+  {
+    b.Field<&Stats::strength>("strength");
+    b.Field<&Stats::agility>("agility");
+    b.Field<&Stats::speed>("speed");
+  }
+
+  struct Item
+  {
+    std::string name{};
+    int count{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Item>, NGIN::Reflection::TypeBuilder<Item> &b)
+  {
+    b.Field<&Item::name>("name");
+    b.Field<&Item::count>("count");
+  }
+
+  struct Character
+  {
+    std::string name{};
+    Stats stats{};
+    std::vector<float> samples{};
+    std::vector<Item> items{};
+    std::map<std::string, int> flags{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Character>, NGIN::Reflection::TypeBuilder<Character> &b)
+  {
+    b.Field<&Character::name>("name");
+    b.Field<&Character::stats>("stats");
+    b.Field<&Character::samples>("samples");
+    b.Field<&Character::items>("items");
+    b.Field<&Character::flags>("flags");
+  }
+} // namespace SerializerDemo
+
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+TEST_CASE("BinarySerializerRoundTripsNestedObjects", "[reflection][BinarySerializer]")
+{
+  using namespace NGIN::Reflection;
+  using SerializerDemo::Character;
+
+  Character src{};
+  src.name = "ranger";
+  src.stats = {7, 9, 1.5f};
+  src.samples = {0.5f, 1.0f, 2.0f};
+  src.items = {{"arrow", 20}, {"bow", 1}};
+  src.flags = {{"met_king", 1}, {"quest", 3}};
+
+  BinarySerializer serializer;
+  std::array<std::byte, 512> buffer{};
+  auto written = serializer.Write(GetType<Character>(), &src, buffer);
+  REQUIRE(written.has_value());
+
+  Character dst{};
+  auto read = serializer.Read(GetType<Character>(), &dst, std::span<const std::byte>{buffer.data(), *written});
+  REQUIRE(read.has_value());
+  CHECK(*read == *written);
+  CHECK(dst.name == "ranger");
+  CHECK(dst.stats.agility == 9);
+  CHECK(dst.stats.speed == 1.5f);
+  CHECK(dst.samples == src.samples);
+  REQUIRE(dst.items.size() == 2);
+  CHECK(dst.items[0].name == "arrow");
+  CHECK(dst.items[1].count == 1);
+  CHECK(dst.flags == src.flags);
+
+  // Character, Stats and Item each get one plan.
+  CHECK(serializer.PlanCount() == 3);
+}
+#else
+TEST_CASE("BinarySerializerRejectsContainersWithoutFieldCodecs", "[reflection][BinarySerializer]")
+{
+  using namespace NGIN::Reflection;
+  using SerializerDemo::Character;
+
+  Character src{};
+  BinarySerializer serializer;
+  std::array<std::byte, 512> buffer{};
+  auto written = serializer.Write(GetType<Character>(), &src, buffer);
+  REQUIRE_FALSE(written.has_value());
+  CHECK(written.error().code == ErrorCode::InvalidArgument);
+  // The failed compile leaves no partial plans behind.
+  CHECK(serializer.PlanCount() == 0);
+}
+#endif
+
+TEST_CASE("BinarySerializerCoalescesAdjacentFields", "[reflection][BinarySerializer]")
+{
+  using namespace NGIN::Reflection;
+  using SerializerDemo::Stats;
+
+  // Three adjacent 4-byte fields are written as one 12-byte span, without padding.
+  Stats s{1, 2, 3.0f};
+  BinarySerializer serializer;
+  std::array<std::byte, 64> buffer{};
+  auto written = serializer.Write(GetType<Stats>(), &s, buffer);
+  REQUIRE(written.has_value());
+  CHECK(*written == sizeof(int) * 2 + sizeof(float));
+}
+
+TEST_CASE("BinarySerializerReportsShortBuffers", "[reflection][BinarySerializer]")
+{
+  using namespace NGIN::Reflection;
+  using SerializerDemo::Item;
+
+  Item item{"a long enough item name", 4};
+  BinarySerializer serializer;
+  std::array<std::byte, 8> small{};
+  BinaryWriter writer{small};
+  REQUIRE(serializer.Write(item, writer).has_value());
+  CHECK(writer.Overflowed());
+  CHECK(writer.Required() == sizeof(NGIN::UInt64) + item.name.size() + sizeof(int));
+  CHECK_FALSE(serializer.Write(GetType<Item>(), &item, small).has_value());
+
+  std::vector<std::byte> big(writer.Required());
+  REQUIRE(serializer.Write(GetType<Item>(), &item, big).has_value());
+  Item back{};
+  CHECK_FALSE(serializer.Read(GetType<Item>(), &back, std::span<const std::byte>{big.data(), big.size() - 1}).has_value());
+  REQUIRE(serializer.Read(GetType<Item>(), &back, big).has_value());
+  CHECK(back.name == item.name);
+}
@@ -0,0 +1,139 @@
+// CallSiteTests.cpp - inline cache for dynamic method invocation by name
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+namespace CallSiteDemo
+{
+  struct Counter
+  {
+    int value{0};
+    int Add(int v) { return value += v; }
+    double Add(double v) { return static_cast<double>(value) + v; }
+    int Get() const { return value; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Counter>, NGIN::Reflection::TypeBuilder<Counter> &b)
+    {
+      b.Method<static_cast<int (Counter::*)(int)>(&Counter::Add)>("Add");
+      b.Method<static_cast<double (Counter::*)(double)>(&Counter::Add)>("Add");
+      b.Method<&Counter::Get>("Get");
+    }
+  };
+
+  struct Doubler
+  {
+    int Add(int v) const { return v * 2; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Doubler>, NGIN::Reflection::TypeBuilder<Doubler> &b)
+    {
+      b.Method<&Doubler::Add>("Add");
+    }
+  };
+
+  int Unrelated(int v) { return v; }
+} // namespace CallSiteDemo
+
+TEST_CASE("CallSiteCachesAfterFirstMiss", "[reflection][CallSite]")
+{
+  using namespace NGIN::Reflection;
+  using CallSiteDemo::Counter;
+
+  auto t = GetType<Counter>();
+  Counter c{};
+  CallSite site{"Add"};
+  Any args[1] = {Any{2}};
+  for (int i = 0; i < 5; ++i)
+  {
+    auto r = site.Invoke(t, &c, args, 1);
+    REQUIRE(r.has_value());
+  }
+  CHECK(c.value == 10);
+  CHECK(site.Misses() == 1);
+  CHECK(site.Hits() == 4);
+  CHECK(site.EntryCount() == 1);
+}
+
+TEST_CASE("CallSiteKeysOnArgumentShapes", "[reflection][CallSite]")
+{
+  using namespace NGIN::Reflection;
+  using CallSiteDemo::Counter;
+
+  auto t = GetType<Counter>();
+  Counter c{1};
+  CallSite site{"Add"};
+  Any ints[1] = {Any{1}};
+  Any doubles[1] = {Any{0.5}};
+  Any shorts[1] = {Any{static_cast<short>(3)}};
+
+  CHECK(site.Invoke(t, &c, ints, 1)->Cast<int>() == 2);
+  CHECK(site.Invoke(t, &c, doubles, 1)->Cast<double>() == 2.5);
+  // short promotes to the int overload and goes through the converting thunk
+  CHECK(site.Invoke(t, &c, shorts, 1)->Cast<int>() == 5);
+  CHECK(site.Invoke(t, &c, shorts, 1)->Cast<int>() == 8);
+  CHECK(site.Invoke(t, &c, doubles, 1)->Cast<double>() == 8.5);
+  CHECK(site.EntryCount() == 3);
+  CHECK(site.Misses() == 3);
+  CHECK(site.Hits() == 2);
+}
+
+TEST_CASE("CallSiteIsPolymorphicOverReceivers", "[reflection][CallSite]")
+{
+  using namespace NGIN::Reflection;
+  using CallSiteDemo::Counter;
+  using CallSiteDemo::Doubler;
+
+  auto tc = GetType<Counter>();
+  auto td = GetType<Doubler>();
+  Counter c{};
+  Doubler d{};
+  CallSite site{"Add"};
+  Any args[1] = {Any{4}};
+  for (int i = 0; i < 3; ++i)
+  {
+    CHECK(site.Invoke(td, &d, args, 1)->Cast<int>() == 8);
+    REQUIRE(site.Invoke(tc, &c, args, 1).has_value());
+  }
+  CHECK(c.value == 12);
+  CHECK(site.EntryCount() == 2);
+  CHECK(site.Misses() == 2);
+}
+
+TEST_CASE("CallSiteInvalidatesOnRegistryChange", "[reflection][CallSite]")
+{
+  using namespace NGIN::Reflection;
+  using CallSiteDemo::Counter;
+
+  auto t = GetType<Counter>();
+  Counter c{};
+  CallSite site{"Get"};
+  REQUIRE(site.Invoke(t, &c, nullptr, 0).has_value());
+  REQUIRE(site.Invoke(t, &c, nullptr, 0).has_value());
+  CHECK(site.Misses() == 1);
+
+  const auto before = detail::RegistryEpoch();
+  (void)RegisterFunction<&CallSiteDemo::Unrelated>("CallSiteDemo::Unrelated");
+  CHECK(detail::RegistryEpoch() != before);
+
+  REQUIRE(site.Invoke(t, &c, nullptr, 0).has_value());
+  CHECK(site.Misses() == 2);
+  CHECK(site.EntryCount() == 1);
+}
+
+TEST_CASE("CallSiteReportsResolutionErrors", "[reflection][CallSite]")
+{
+  using namespace NGIN::Reflection;
+  using CallSiteDemo::Counter;
+
+  auto t = GetType<Counter>();
+  Counter c{};
+  CallSite missing{"Nope"};
+  auto r = missing.Invoke(t, &c, nullptr, 0);
+  REQUIRE_FALSE(r.has_value());
+  CHECK(r.error().code == ErrorCode::NotFound);
+
+  CallSite site{"Add"};
+  Any bad[1] = {Any{std::string_view{"x"}}};
+  CHECK_FALSE(site.Invoke(t, &c, bad, 1).has_value());
+  CHECK(site.EntryCount() == 0);
+}
@@ -18,6 +18,8 @@ namespace DiagDemo
       b.Method<static_cast<double (D::*)(double) const>(&D::f)>("f");
     }
   };
+
+  int Id(int v) { return v; }
 } // namespace DiagDemo
 
 TEST_CASE("ResolveDiagnosticsReportNonConvertible", "[reflection][Diagnostics]")
@@ -27,7 +29,7 @@ TEST_CASE("ResolveDiagnosticsReportNonConvertible", "[reflection][Diagnostics]")
 
   auto t = GetType<D>();
   Any bad[1] = {Any{std::string{"x"}}};
-  auto r = t.ResolveMethod("f", bad, 1);
+  auto r = t.ResolveMethod("f", bad, 1, ResolveOptions{.collectDiagnostics = true});
   CHECK_FALSE(r.has_value());
   auto err = r.error();
   CHECK(err.diagnostics.Size() == 2);
@@ -46,7 +48,7 @@ TEST_CASE("ResolveDiagnosticsReportArityMismatch", "[reflection][Diagnostics]")
 
   auto t = GetType<D>();
   Any two[2] = {Any{1}, Any{2}};
-  auto r = t.ResolveMethod("f", two, 2);
+  auto r = t.ResolveMethod("f", two, 2, ResolveOptions{.collectDiagnostics = true});
   CHECK_FALSE(r.has_value());
   auto err = r.error();
   CHECK(err.diagnostics.Size() == 2);
@@ -57,3 +59,48 @@ TEST_CASE("ResolveDiagnosticsReportArityMismatch", "[reflection][Diagnostics]")
   }
   CHECK(err.closestMethodIndex.has_value());
 }
+
+TEST_CASE("ResolveFailureIsCompactByDefault", "[reflection][Diagnostics]")
+{
+  using namespace NGIN::Reflection;
+  using DiagDemo::D;
+
+  auto t = GetType<D>();
+  Any bad[1] = {Any{std::string{"x"}}};
+  auto r = t.ResolveMethod("f", bad, 1);
+  REQUIRE_FALSE(r.has_value());
+  const auto &err = r.error();
+  CHECK(err.diagnostics.Size() == 0);
+  CHECK(err.candidateCount == 2);
+  CHECK(err.reason == DiagnosticCode::NonConvertible);
+  CHECK(err.argIndex == 0);
+  CHECK(err.closestMethodIndex.has_value());
+
+  Any two[2] = {Any{1}, Any{2}};
+  auto r2 = t.ResolveMethod("f", two, 2);
+  REQUIRE_FALSE(r2.has_value());
+  CHECK(r2.error().reason == DiagnosticCode::ArityMismatch);
+  CHECK(r2.error().diagnostics.Size() == 0);
+}
+
+TEST_CASE("ResolveFunctionDiagnosticsAreOptIn", "[reflection][Diagnostics]")
+{
+  using namespace NGIN::Reflection;
+
+  static bool registered = false;
+  if (!registered)
+  {
+    (void)RegisterFunction<&DiagDemo::Id>("DiagDemo::Id");
+    registered = true;
+  }
+  Any bad[1] = {Any{std::string{"x"}}};
+  auto quiet = ResolveFunction("DiagDemo::Id", bad, 1);
+  REQUIRE_FALSE(quiet.has_value());
+  CHECK(quiet.error().diagnostics.Size() == 0);
+  CHECK(quiet.error().reason == DiagnosticCode::NonConvertible);
+
+  auto loud = ResolveFunction("DiagDemo::Id", bad, 1, ResolveOptions{.collectDiagnostics = true});
+  REQUIRE_FALSE(loud.has_value());
+  REQUIRE(loud.error().diagnostics.Size() == 1);
+  CHECK(loud.error().diagnostics[0].name == "DiagDemo::Id");
+}
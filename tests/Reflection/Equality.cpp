@@ -0,0 +1,162 @@
+// Equality.cpp - Type::Equals / Type::Hash generated from field metadata
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace EqualityDemo
+{
+  struct Padded
+  {
+    char tag{0};
+    int value{0};
+    double weight{0.0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Padded>, NGIN::Reflection::TypeBuilder<Padded> &b)
+  {
+    b.Field<&Padded::tag>("tag");
+    b.Field<&Padded::value>("value");
+    b.Field<&Padded::weight>("weight");
+  }
+
+  struct Asset
+  {
+    std::string name{};
+    std::vector<Padded> parts{};
+    std::unordered_map<std::string, int> tags{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Asset>, NGIN::Reflection::TypeBuilder<Asset> &b)
+  {
+    b.Field<&Asset::name>("name");
+    b.Field<&Asset::parts>("parts");
+    b.Field<&Asset::tags>("tags");
+  }
+
+  struct Label
+  {
+    std::string text{};
+    float scale{1.0f};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Label>, NGIN::Reflection::TypeBuilder<Label> &b)
+  {
+    b.Field<&Label::text>("text");
+    b.Field<&Label::scale>("scale");
+  }
+
+  // Neither reflected nor bytewise: the plan compiler cannot compare it.
+  struct Shared
+  {
+    std::shared_ptr<int> value{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Shared>, NGIN::Reflection::TypeBuilder<Shared> &b)
+  {
+    b.Field<&Shared::value>("value");
+  }
+} // namespace EqualityDemo
+
+TEST_CASE("EqualsAndHashIgnorePadding", "[reflection][Equality]")
+{
+  using namespace NGIN::Reflection;
+  using EqualityDemo::Padded;
+
+  // Same field values over different garbage in the padding bytes.
+  alignas(Padded) unsigned char bufA[sizeof(Padded)];
+  alignas(Padded) unsigned char bufB[sizeof(Padded)];
+  std::memset(bufA, 0xAA, sizeof(bufA));
+  std::memset(bufB, 0x55, sizeof(bufB));
+  auto *a = ::new (bufA) Padded;
+  auto *b = ::new (bufB) Padded;
+  a->tag = b->tag = 'x';
+  a->value = b->value = 42;
+  a->weight = b->weight = 2.5;
+
+  auto t = GetType<Padded>();
+  auto eq = t.Equals(a, b);
+  REQUIRE(eq.has_value());
+  CHECK(*eq);
+  REQUIRE(t.Hash(a).has_value());
+  CHECK(t.Hash(a).value() == t.Hash(b).value());
+
+  b->value = 43;
+  CHECK_FALSE(t.Equals(a, b).value());
+  CHECK(t.Hash(a).value() != t.Hash(b).value());
+}
+
+TEST_CASE("EqualsComparesStringsAndFloatsBitwise", "[reflection][Equality]")
+{
+  using namespace NGIN::Reflection;
+  using EqualityDemo::Label;
+
+  auto t = GetType<Label>();
+  Label a{"title", 0.0f};
+  Label b{std::string{"title"}, 0.0f};
+  CHECK(t.Equals(&a, &b).value());
+  CHECK(t.Hash(&a).value() == t.Hash(&b).value());
+
+  b.text = "other";
+  CHECK_FALSE(t.Equals(&a, &b).value());
+
+  // Floats are compared by their bits, not by operator==.
+  b.text = a.text;
+  b.scale = -0.0f;
+  CHECK_FALSE(t.Equals(&a, &b).value());
+  a.scale = b.scale = std::numeric_limits<float>::quiet_NaN();
+  CHECK(t.Equals(&a, &b).value());
+}
+
+TEST_CASE("EqualsOfTheSameObjectStillNeedsAPlan", "[reflection][Equality]")
+{
+  using namespace NGIN::Reflection;
+  using EqualityDemo::Shared;
+
+  Shared s{};
+  auto eq = GetType<Shared>().Equals(&s, &s);
+  REQUIRE_FALSE(eq.has_value());
+  CHECK(eq.error().code == ErrorCode::InvalidArgument);
+}
+
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+TEST_CASE("EqualsAndHashRecurseThroughContainers", "[reflection][Equality]")
+{
+  using namespace NGIN::Reflection;
+  using EqualityDemo::Asset;
+
+  Asset a{"rock", {{'a', 1, 0.5}, {'b', 2, 1.5}}, {}};
+  a.tags.emplace("biome", 3);
+  a.tags.emplace("lod", 1);
+  Asset b{"rock", {{'a', 1, 0.5}, {'b', 2, 1.5}}, {}};
+  b.tags.emplace("lod", 1);
+  b.tags.emplace("biome", 3);
+
+  auto t = GetType<Asset>();
+  CHECK(t.Equals(&a, &b).value());
+  CHECK(t.Hash(&a).value() == t.Hash(&b).value());
+
+  b.parts[1].weight = 2.0;
+  CHECK_FALSE(t.Equals(&a, &b).value());
+  CHECK(t.Hash(&a).value() != t.Hash(&b).value());
+
+  b.parts[1].weight = 1.5;
+  b.tags["lod"] = 2;
+  CHECK_FALSE(t.Equals(&a, &b).value());
+}
+#else
+TEST_CASE("EqualsRejectsContainersWithoutFieldCodecs", "[reflection][Equality]")
+{
+  using namespace NGIN::Reflection;
+  using EqualityDemo::Asset;
+
+  Asset a{}, b{};
+  auto eq = GetType<Asset>().Equals(&a, &b);
+  REQUIRE_FALSE(eq.has_value());
+  CHECK(eq.error().code == ErrorCode::InvalidArgument);
+}
+#endif
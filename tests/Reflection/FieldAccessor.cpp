@@ -0,0 +1,66 @@
+// FieldAccessor.cpp - Field::Bind<T>() typed accessors
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+
+namespace AccessorDemo
+{
+  struct Position
+  {
+    float x{0.0f};
+    float y{0.0f};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Position>, NGIN::Reflection::TypeBuilder<Position> &b)
+  {
+    b.Field<&Position::x>("x");
+    b.Field<&Position::y>("y");
+  }
+
+  struct Named
+  {
+    virtual ~Named() = default;
+    std::string name{"unnamed"};
+    friend void NginReflect(NGIN::Reflection::Tag<Named>, NGIN::Reflection::TypeBuilder<Named> &b)
+    {
+      b.Field<&Named::name>("name");
+    }
+  };
+} // namespace AccessorDemo
+
+TEST_CASE("FieldAccessorReadsAndWritesThroughOffset", "[reflection][FieldAccessor]")
+{
+  using namespace NGIN::Reflection;
+  using AccessorDemo::Position;
+
+  auto y = GetType<Position>().GetField("y")->Bind<float>();
+  REQUIRE(y.has_value());
+  CHECK(y->IsValid());
+
+  Position p{1.0f, 2.0f};
+  CHECK((*y)(p) == 2.0f);
+  (*y)(p) = 5.0f;
+  CHECK(p.y == 5.0f);
+
+  const Position &cp = p;
+  const float &ref = (*y)(cp);
+  CHECK(&ref == &p.y);
+
+  CHECK(GetType<Position>().GetField("x")->Bind<int>().error().code == ErrorCode::InvalidArgument);
+  CHECK_FALSE(FieldAccessor<float>{}.IsValid());
+}
+
+TEST_CASE("FieldAccessorFallsBackToGetter", "[reflection][FieldAccessor]")
+{
+  using namespace NGIN::Reflection;
+  using AccessorDemo::Named;
+
+  auto name = GetType<Named>().GetField("name")->Bind<std::string>();
+  REQUIRE(name.has_value());
+  Named n{};
+  CHECK((*name)(n) == "unnamed");
+  (*name)(static_cast<void *>(&n)) = "bound";
+  CHECK(n.name == "bound");
+}
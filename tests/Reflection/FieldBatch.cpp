@@ -0,0 +1,83 @@
+// FieldBatch.cpp - Type::ReadFields / WriteFields batch access
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+
+namespace BatchDemo
+{
+  struct Save
+  {
+    int level{0};
+    float health{0.0f};
+    std::string zone{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Save>, NGIN::Reflection::TypeBuilder<Save> &b)
+  {
+    b.Field<&Save::level>("level");
+    b.Field<&Save::health>("health");
+    b.Field<&Save::zone>("zone");
+  }
+
+  struct Other
+  {
+    int value{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Other>, NGIN::Reflection::TypeBuilder<Other> &b)
+  {
+    b.Field<&Other::value>("value");
+  }
+} // namespace BatchDemo
+
+TEST_CASE("ReadFieldsAndWriteFieldsRoundTrip", "[reflection][FieldBatch]")
+{
+  using namespace NGIN::Reflection;
+  using BatchDemo::Save;
+
+  auto t = GetType<Save>();
+  Save s{3, 75.0f, "forest"};
+  Any values[3];
+  auto read = t.ReadFields(&s, values);
+  REQUIRE(read.has_value());
+  CHECK(*read == 3);
+  CHECK(values[0].Cast<int>() == 3);
+  CHECK(values[2].Cast<std::string>() == "forest");
+
+  Save loaded{};
+  REQUIRE(t.WriteFields(&loaded, std::span<const Any>{values}).has_value());
+  CHECK(loaded.level == 3);
+  CHECK(loaded.health == 75.0f);
+  CHECK(loaded.zone == "forest");
+
+  Any tooFew[2];
+  CHECK_FALSE(t.ReadFields(&s, tooFew).has_value());
+
+  // A mismatched value rejects the whole write.
+  const Any bad[3] = {Any{9}, Any{1.0}, Any{std::string{"cave"}}};
+  CHECK_FALSE(t.WriteFields(&loaded, bad).has_value());
+  CHECK(loaded.level == 3);
+}
+
+TEST_CASE("ReadFieldsWithHandleSubset", "[reflection][FieldBatch]")
+{
+  using namespace NGIN::Reflection;
+  using BatchDemo::Save;
+
+  auto t = GetType<Save>();
+  const Field subset[2] = {t.GetField("zone").value(), t.GetField("level").value()};
+  Save s{7, 10.0f, "desert"};
+  Any out[2];
+  REQUIRE(t.ReadFields(&s, subset, out).has_value());
+  CHECK(out[0].Cast<std::string>() == "desert");
+  CHECK(out[1].Cast<int>() == 7);
+
+  const Any values[2] = {Any{std::string{"tundra"}}, Any{8}};
+  REQUIRE(t.WriteFields(&s, subset, values).has_value());
+  CHECK(s.zone == "tundra");
+  CHECK(s.level == 8);
+
+  const Field foreign[1] = {GetType<BatchDemo::Other>().GetField("value").value()};
+  CHECK_FALSE(t.ReadFields(&s, foreign, out).has_value());
+}
@@ -0,0 +1,155 @@
+// FieldDelta.cpp - Type::Diff / ApplyPatch field-level deltas
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+#include <vector>
+
+namespace DeltaDemo
+{
+  struct Vec3
+  {
+    float x{0}, y{0}, z{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Vec3>, NGIN::Reflection::TypeBuilder<Vec3> &b)
+  {
+    b.Field<&Vec3::x>("x");
+    b.Field<&Vec3::y>("y");
+    b.Field<&Vec3::z>("z");
+  }
+
+  struct Player
+  {
+    int id{0};
+    Vec3 position{};
+    float health{100.0f};
+    std::string name{};
+    std::vector<int> items{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Player>, NGIN::Reflection::TypeBuilder<Player> &b)
+  {
+    b.Field<&Player::id>("id");
+    b.Field<&Player::position>("position");
+    b.Field<&Player::health>("health");
+    b.Field<&Player::name>("name");
+    b.Field<&Player::items>("items");
+  }
+
+  // No container members, so it diffs with or without the registration-time codecs.
+  struct Badge
+  {
+    int level{0};
+    std::string title{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Badge>, NGIN::Reflection::TypeBuilder<Badge> &b)
+  {
+    b.Field<&Badge::level>("level");
+    b.Field<&Badge::title>("title");
+  }
+} // namespace DeltaDemo
+
+TEST_CASE("DiffHandlesStringMembers", "[reflection][FieldDelta]")
+{
+  using namespace NGIN::Reflection;
+  using DeltaDemo::Badge;
+
+  auto t = GetType<Badge>();
+  Badge from{3, "bronze"};
+  Badge to{3, "silver"};
+  auto patch = t.Diff(&from, &to);
+  REQUIRE(patch.has_value());
+  CHECK(patch->mask[0] == (1u << 1));
+  CHECK(patch->payload.size() == sizeof(NGIN::UInt64) + to.title.size());
+
+  Badge replica = from;
+  REQUIRE(t.ApplyPatch(&replica, *patch).has_value());
+  CHECK(replica.title == "silver");
+  CHECK(replica.level == 3);
+}
+
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+
+TEST_CASE("DiffOfEqualObjectsIsEmpty", "[reflection][FieldDelta]")
+{
+  using namespace NGIN::Reflection;
+  using DeltaDemo::Player;
+
+  Player a{7, {1, 2, 3}, 50.0f, "scout", {1, 2}};
+  Player b = a;
+  FieldPatch patch;
+  auto changed = GetType<Player>().Diff(&a, &b, patch);
+  REQUIRE(changed.has_value());
+  CHECK_FALSE(*changed);
+  CHECK(patch.Empty());
+  CHECK(patch.payload.empty());
+}
+
+TEST_CASE("DiffCarriesOnlyChangedFields", "[reflection][FieldDelta]")
+{
+  using namespace NGIN::Reflection;
+  using DeltaDemo::Player;
+
+  auto t = GetType<Player>();
+  Player from{7, {1, 2, 3}, 50.0f, "scout", {1, 2}};
+  Player to = from;
+  to.position.y = 9.0f;
+  to.name = "ranger";
+
+  auto patch = t.Diff(&from, &to);
+  REQUIRE(patch.has_value());
+  REQUIRE(patch->mask.size() == 1);
+  CHECK(patch->mask[0] == ((1u << 1) | (1u << 3)));
+  // Nested mask word + position.y, then the length-prefixed name.
+  CHECK(patch->payload.size() == sizeof(NGIN::UInt64) + sizeof(float) + sizeof(NGIN::UInt64) + to.name.size());
+
+  Player replica = from;
+  REQUIRE(t.ApplyPatch(&replica, *patch).has_value());
+  CHECK(replica.position.y == 9.0f);
+  CHECK(replica.position.x == 1.0f);
+  CHECK(replica.name == "ranger");
+  CHECK(replica.items == from.items);
+
+  auto again = t.Diff(&replica, &to);
+  REQUIRE(again.has_value());
+  CHECK(again->Empty());
+}
+
+TEST_CASE("ApplyPatchRejectsMismatchedPatches", "[reflection][FieldDelta]")
+{
+  using namespace NGIN::Reflection;
+  using DeltaDemo::Player;
+
+  auto t = GetType<Player>();
+  Player from{}, to{};
+  to.health = 1.0f;
+  to.name = "x";
+  auto patch = t.Diff(&from, &to);
+  REQUIRE(patch.has_value());
+
+  Player target{};
+  FieldPatch truncated = *patch;
+  truncated.payload.pop_back();
+  CHECK_FALSE(t.ApplyPatch(&target, truncated).has_value());
+
+  FieldPatch extraBit = *patch;
+  extraBit.mask[0] |= NGIN::UInt64{1} << 40;
+  CHECK_FALSE(t.ApplyPatch(&target, extraBit).has_value());
+
+  // Same mask width, but the name bit is past Vec3's last field.
+  CHECK_FALSE(GetType<DeltaDemo::Vec3>().ApplyPatch(&target.position, *patch).has_value());
+}
+#else
+TEST_CASE("DiffRejectsContainersWithoutFieldCodecs", "[reflection][FieldDelta]")
+{
+  using namespace NGIN::Reflection;
+  using DeltaDemo::Player;
+
+  Player a{}, b{};
+  FieldPatch patch;
+  auto changed = GetType<Player>().Diff(&a, &b, patch);
+  REQUIRE_FALSE(changed.has_value());
+  CHECK(changed.error().code == ErrorCode::InvalidArgument);
+}
+#endif
@@ -0,0 +1,95 @@
+// FieldGather.cpp - Field offsets and strided Gather/Scatter over object arrays
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace GatherDemo
+{
+  struct Sample
+  {
+    int id{0};
+    float value{0.0f};
+    double weight{0.0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Sample>, NGIN::Reflection::TypeBuilder<Sample> &b)
+  {
+    b.Field<&Sample::id>("id");
+    b.Field<&Sample::value>("value");
+    b.Field<&Sample::weight>("weight");
+  }
+
+  struct Tagged
+  {
+    virtual ~Tagged() = default;
+    std::string tag{};
+    friend void NginReflect(NGIN::Reflection::Tag<Tagged>, NGIN::Reflection::TypeBuilder<Tagged> &b)
+    {
+      b.Field<&Tagged::tag>("tag");
+    }
+  };
+} // namespace GatherDemo
+
+TEST_CASE("FieldOffsetIsRecordedForStandardLayout", "[reflection][FieldGather]")
+{
+  using namespace NGIN::Reflection;
+  using GatherDemo::Sample;
+
+  auto t = GetType<Sample>();
+  CHECK(t.GetField("id")->Offset() == offsetof(Sample, id));
+  CHECK(t.GetField("value")->Offset() == offsetof(Sample, value));
+  CHECK(t.GetField("weight")->Offset() == offsetof(Sample, weight));
+  CHECK_FALSE(GetType<GatherDemo::Tagged>().GetField("tag")->Offset().has_value());
+}
+
+TEST_CASE("FieldGatherAndScatterCopyAcrossArrays", "[reflection][FieldGather]")
+{
+  using namespace NGIN::Reflection;
+  using GatherDemo::Sample;
+
+  std::vector<Sample> samples(1000);
+  for (int i = 0; i < 1000; ++i)
+    samples[i] = Sample{i, static_cast<float>(i) * 0.5f, 0.0};
+
+  auto value = GetType<Sample>().GetField("value").value();
+  std::vector<float> values(samples.size());
+  REQUIRE(value.Gather(samples.data(), sizeof(Sample), samples.size(), values.data()).has_value());
+  CHECK(values[0] == 0.0f);
+  CHECK(values[999] == 499.5f);
+
+  for (auto &v : values)
+    v *= 2.0f;
+  REQUIRE(value.Scatter(samples.data(), sizeof(Sample), samples.size(), values.data()).has_value());
+  CHECK(samples[10].value == 10.0f);
+  CHECK(samples[10].id == 10);
+
+  // Every other object via a doubled stride.
+  std::vector<int> ids(500);
+  auto id = GetType<Sample>().GetField("id").value();
+  REQUIRE(id.Gather(samples.data(), sizeof(Sample) * 2, ids.size(), ids.data()).has_value());
+  CHECK(ids[1] == 2);
+  CHECK(ids[499] == 998);
+}
+
+TEST_CASE("FieldGatherCopiesNonTrivialFields", "[reflection][FieldGather]")
+{
+  using namespace NGIN::Reflection;
+  using GatherDemo::Tagged;
+
+  Tagged objects[3];
+  objects[0].tag = "a";
+  objects[2].tag = "c";
+  std::string tags[3];
+  auto tag = GetType<Tagged>().GetField("tag").value();
+  REQUIRE(tag.Gather(objects, sizeof(Tagged), 3, tags).has_value());
+  CHECK(tags[0] == "a");
+  CHECK(tags[2] == "c");
+
+  tags[1] = "b";
+  REQUIRE(tag.Scatter(objects, sizeof(Tagged), 3, tags).has_value());
+  CHECK(objects[1].tag == "b");
+}
@@ -0,0 +1,136 @@
+// FieldPath.cpp - Type::CompilePath resolving dotted member paths
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+
+namespace FieldPathDemo
+{
+  struct Vec3
+  {
+    float x{0}, y{0}, z{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Vec3>, NGIN::Reflection::TypeBuilder<Vec3> &b)
+  {
+    b.Field<&Vec3::x>("x");
+    b.Field<&Vec3::y>("y");
+    b.Field<&Vec3::z>("z");
+  }
+
+  struct Transform
+  {
+    Vec3 position{};
+    Vec3 scale{1, 1, 1};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Transform>, NGIN::Reflection::TypeBuilder<Transform> &b)
+  {
+    b.Field<&Transform::position>("position");
+    b.Field<&Transform::scale>("scale");
+  }
+
+  struct Node
+  {
+    std::string name{};
+    Transform transform{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Node>, NGIN::Reflection::TypeBuilder<Node> &b)
+  {
+    b.Field<&Node::name>("name");
+    b.Field<&Node::transform>("transform");
+  }
+
+  // Mixed access control makes this non-standard-layout, so its fields carry no offset.
+  class Actor
+  {
+  public:
+    int id{0};
+    Node node{};
+
+  private:
+    int m_secret{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Actor>, NGIN::Reflection::TypeBuilder<Actor> &b)
+  {
+    b.Field<&Actor::id>("id");
+    b.Field<&Actor::node>("node");
+  }
+} // namespace FieldPathDemo
+
+TEST_CASE("CompilePathCollapsesToOneOffset", "[reflection][FieldPath]")
+{
+  using namespace NGIN::Reflection;
+  using FieldPathDemo::Node;
+
+  auto path = GetType<Node>().CompilePath("transform.position.y");
+  REQUIRE(path.has_value());
+  CHECK(path->Is<float>());
+  CHECK(path->Depth() == 3);
+  REQUIRE(path->Offset().has_value());
+  Node n{};
+  CHECK(*path->Offset() == static_cast<NGIN::UIntSize>(reinterpret_cast<unsigned char *>(&n.transform.position.y) -
+                                                       reinterpret_cast<unsigned char *>(&n)));
+
+  path->Set<float>(&n, 4.5f);
+  CHECK(n.transform.position.y == 4.5f);
+  CHECK(path->Get<float>(static_cast<const void *>(&n)) == 4.5f);
+
+  REQUIRE(path->SetAny(&n, Any{2.0f}).has_value());
+  CHECK(n.transform.position.y == 2.0f);
+  CHECK(path->GetAny(&n).Cast<float>() == 2.0f);
+  CHECK_FALSE(path->SetAny(&n, Any{2}).has_value());
+}
+
+TEST_CASE("CompilePathGetAnyAndSetAnyUseTheLeafOwner", "[reflection][FieldPath]")
+{
+  using namespace NGIN::Reflection;
+  using FieldPathDemo::Node;
+
+  // Neither the owner (Node::transform.scale) nor the leaf sits at offset 0 of its parent.
+  auto path = GetType<Node>().CompilePath("transform.scale.z");
+  REQUIRE(path.has_value());
+  REQUIRE(path->Offset().has_value());
+  Node n{};
+  n.name = "untouched";
+  n.transform.scale.z = 7.0f;
+  CHECK(path->GetAny(&n).Cast<float>() == 7.0f);
+
+  REQUIRE(path->SetAny(&n, Any{9.0f}).has_value());
+  CHECK(n.transform.scale.z == 9.0f);
+  CHECK(n.transform.scale.x == 1.0f);
+  CHECK(n.transform.position.z == 0.0f);
+  CHECK(n.name == "untouched");
+}
+
+TEST_CASE("CompilePathFallsBackToAccessorChain", "[reflection][FieldPath]")
+{
+  using namespace NGIN::Reflection;
+  using FieldPathDemo::Actor;
+
+  auto path = GetType<Actor>().CompilePath("node.transform.scale.z");
+  REQUIRE(path.has_value());
+  CHECK_FALSE(path->Offset().has_value());
+  Actor a{};
+  CHECK(path->Get<float>(&a) == 1.0f);
+  path->Set<float>(&a, 3.0f);
+  CHECK(a.node.transform.scale.z == 3.0f);
+
+  auto name = GetType<Actor>().CompilePath("node.name");
+  REQUIRE(name.has_value());
+  REQUIRE(name->SetAny(&a, Any{std::string{"hero"}}).has_value());
+  CHECK(a.node.name == "hero");
+}
+
+TEST_CASE("CompilePathRejectsBadPaths", "[reflection][FieldPath]")
+{
+  using namespace NGIN::Reflection;
+  using FieldPathDemo::Node;
+
+  auto t = GetType<Node>();
+  CHECK(t.CompilePath("transform.rotation").error().code == ErrorCode::NotFound);
+  CHECK(t.CompilePath("transform..x").error().code == ErrorCode::InvalidArgument);
+  CHECK(t.CompilePath("").error().code == ErrorCode::InvalidArgument);
+  // std::string is not a reflected type with fields to descend into.
+  CHECK(t.CompilePath("name.size").error().code == ErrorCode::InvalidArgument);
+}
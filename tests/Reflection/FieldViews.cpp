@@ -0,0 +1,59 @@
+// FieldViews.cpp - Field::GetView/GetMutView and adapters started from views
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+#include <NGIN/Reflection/Adapters.hpp>
+
+#include <string>
+#include <vector>
+
+namespace FieldViewDemo
+{
+  struct Inventory
+  {
+    std::vector<int> items{};
+    std::string owner{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Inventory>, NGIN::Reflection::TypeBuilder<Inventory> &b)
+  {
+    b.Field<&Inventory::items>("items");
+    b.Field<&Inventory::owner>("owner");
+  }
+} // namespace FieldViewDemo
+
+TEST_CASE("FieldViewsReferToTheMember", "[reflection][FieldViews]")
+{
+  using namespace NGIN::Reflection;
+  using FieldViewDemo::Inventory;
+
+  Inventory inv{{1, 2, 3}, "merchant"};
+  auto owner = GetType<Inventory>().GetField("owner").value();
+
+  auto view = owner.GetView(inv);
+  REQUIRE(view.has_value());
+  CHECK(&view->Cast<std::string>() == &inv.owner);
+
+  auto mut = owner.GetMutView(inv);
+  REQUIRE(mut.has_value());
+  mut->Cast<std::string>() = "smith";
+  CHECK(inv.owner == "smith");
+}
+
+TEST_CASE("AdaptersStartFromFieldViews", "[reflection][FieldViews]")
+{
+  using namespace NGIN::Reflection;
+  using FieldViewDemo::Inventory;
+
+  Inventory inv{{4, 5, 6}, "merchant"};
+  auto items = GetType<Inventory>().GetField("items").value();
+  auto view = items.GetView(inv);
+  REQUIRE(view.has_value());
+
+  auto seq = Adapters::AdaptView<Adapters::SequenceAdapter, std::vector<int>>(*view);
+  REQUIRE(seq.has_value());
+  CHECK(seq->Size() == 3);
+  CHECK(&seq->ElementView(1).Cast<int>() == &inv.items[1]);
+
+  CHECK_FALSE((Adapters::AdaptView<Adapters::SequenceAdapter, std::vector<float>>(*view).has_value()));
+}
@@ -0,0 +1,110 @@
+// InPlaceConstruction.cpp - ConstructAt and Destroy/Move/Copy thunks on caller storage
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <array>
+#include <string>
+
+namespace InPlaceDemo
+{
+  struct Particle
+  {
+    static inline int alive = 0;
+
+    std::array<float, 16> data{};
+    std::string label{"default"};
+    int id{0};
+
+    Particle() { ++alive; }
+    Particle(int i, std::string l) : label(std::move(l)), id(i) { ++alive; }
+    Particle(const Particle &o) : data(o.data), label(o.label), id(o.id) { ++alive; }
+    Particle(Particle &&o) noexcept : data(o.data), label(std::move(o.label)), id(o.id) { ++alive; }
+    ~Particle() { --alive; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Particle>, NGIN::Reflection::TypeBuilder<Particle> &b)
+    {
+      b.Constructor<int, std::string>();
+    }
+  };
+
+  struct Pinned
+  {
+    Pinned() = default;
+    Pinned(const Pinned &) = delete;
+    Pinned(Pinned &&) = delete;
+  };
+} // namespace InPlaceDemo
+
+TEST_CASE("ConstructAtBuildsIntoCallerStorage", "[reflection][InPlaceConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using InPlaceDemo::Particle;
+
+  auto t = GetType<Particle>();
+  REQUIRE(t.Size() == sizeof(Particle));
+  REQUIRE(t.Alignment() == alignof(Particle));
+
+  alignas(Particle) unsigned char storage[sizeof(Particle)];
+  const int before = Particle::alive;
+  // short promotes to int through the converting path
+  Any args[2] = {Any{static_cast<short>(7)}, Any{std::string{"spark"}}};
+  REQUIRE(t.ConstructAt(storage, args, 2).has_value());
+  auto *p = reinterpret_cast<Particle *>(storage);
+  CHECK(p->id == 7);
+  CHECK(p->label == "spark");
+  CHECK(Particle::alive == before + 1);
+  REQUIRE(t.Destroy(storage).has_value());
+  CHECK(Particle::alive == before);
+
+  const Any *noArgs = nullptr;
+  REQUIRE(t.ConstructAt(storage, noArgs, 0).has_value());
+  CHECK(p->label == "default");
+  REQUIRE(t.Destroy(storage).has_value());
+
+  Any bad[1] = {Any{1}};
+  CHECK_FALSE(t.ConstructAt(storage, bad, 1).has_value());
+  CHECK(Particle::alive == before);
+}
+
+TEST_CASE("MoveAndCopyConstructThunks", "[reflection][InPlaceConstruction]")
+{
+  using namespace NGIN::Reflection;
+  using InPlaceDemo::Particle;
+
+  auto t = GetType<Particle>();
+  alignas(Particle) unsigned char a[sizeof(Particle)];
+  alignas(Particle) unsigned char b[sizeof(Particle)];
+  alignas(Particle) unsigned char c[sizeof(Particle)];
+  const int before = Particle::alive;
+
+  auto ctor = t.ResolveConstructor<int, std::string>();
+  REQUIRE(ctor.has_value());
+  Any args[2] = {Any{3}, Any{std::string{"ember"}}};
+  REQUIRE(ctor->ConstructAt(a, args, 2).has_value());
+  REQUIRE(t.CopyConstruct(b, a).has_value());
+  REQUIRE(t.MoveConstruct(c, a).has_value());
+  CHECK(reinterpret_cast<Particle *>(b)->label == "ember");
+  CHECK(reinterpret_cast<Particle *>(c)->label == "ember");
+  CHECK(reinterpret_cast<Particle *>(c)->id == 3);
+  CHECK(Particle::alive == before + 3);
+
+  for (auto *obj : {a, b, c})
+    REQUIRE(t.Destroy(obj).has_value());
+  CHECK(Particle::alive == before);
+}
+
+TEST_CASE("MissingLifecycleOperationsReportNotFound", "[reflection][InPlaceConstruction]")
+{
+  using namespace NGIN::Reflection;
+
+  auto t = GetType<InPlaceDemo::Pinned>();
+  alignas(InPlaceDemo::Pinned) unsigned char a[sizeof(InPlaceDemo::Pinned)];
+  alignas(InPlaceDemo::Pinned) unsigned char b[sizeof(InPlaceDemo::Pinned)];
+  const Any *noArgs = nullptr;
+  REQUIRE(t.ConstructAt(a, noArgs, 0).has_value());
+  CHECK(t.CopyConstruct(b, a).error().code == ErrorCode::NotFound);
+  CHECK(t.MoveConstruct(b, a).error().code == ErrorCode::NotFound);
+  CHECK(t.Destroy(a).has_value());
+}
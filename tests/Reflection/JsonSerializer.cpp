@@ -0,0 +1,218 @@
+// JsonSerializer.cpp - streaming JSON round trips through per-type key plans
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace JsonDemo
+{
+  enum class Difficulty : unsigned char
+  {
+    Easy,
+    Hard,
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Difficulty>, NGIN::Reflection::TypeBuilder<Difficulty> &b)
+  {
+    b.EnumValue("Easy", Difficulty::Easy);
+    b.EnumValue("Hard", Difficulty::Hard);
+  }
+
+  struct Window
+  {
+    int width{0};
+    int height{0};
+    bool fullscreen{false};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Window>, NGIN::Reflection::TypeBuilder<Window> &b)
+  {
+    b.Field<&Window::width>("width");
+    b.Field<&Window::height>("height");
+    b.Field<&Window::fullscreen>("fullscreen");
+  }
+
+  struct Config
+  {
+    std::string title{};
+    double volume{0.0};
+    Difficulty difficulty{Difficulty::Easy};
+    Window window{};
+    std::vector<int> recent{};
+    std::map<std::string, float> keys{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Config>, NGIN::Reflection::TypeBuilder<Config> &b)
+  {
+    b.Field<&Config::title>("title");
+    b.Field<&Config::volume>("volume");
+    b.Field<&Config::difficulty>("difficulty");
+    b.Field<&Config::window>("window");
+    b.Field<&Config::recent>("recent");
+    b.Field<&Config::keys>("keys");
+  }
+
+  // Only scalar and string fields: no registration-time codec involved.
+  struct Scalars
+  {
+    bool flag{false};
+    char letter{0};
+    unsigned char byte{0};
+    short small{0};
+    unsigned int count{0};
+    long long big{0};
+    float ratio{0.0f};
+    double precise{0.0};
+    std::string label{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Scalars>, NGIN::Reflection::TypeBuilder<Scalars> &b)
+  {
+    b.Field<&Scalars::flag>("flag");
+    b.Field<&Scalars::letter>("letter");
+    b.Field<&Scalars::byte>("byte");
+    b.Field<&Scalars::small>("small");
+    b.Field<&Scalars::count>("count");
+    b.Field<&Scalars::big>("big");
+    b.Field<&Scalars::ratio>("ratio");
+    b.Field<&Scalars::precise>("precise");
+    b.Field<&Scalars::label>("label");
+  }
+
+  // Nests as deep as its input does.
+  struct Tree
+  {
+    std::vector<Tree> children{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Tree>, NGIN::Reflection::TypeBuilder<Tree> &b)
+  {
+    b.Field<&Tree::children>("children");
+  }
+
+  std::string NestedTree(int levels)
+  {
+    std::string text;
+    for (int i = 0; i < levels; ++i)
+      text += R"({"children":[)";
+    text += R"({"children":[]})";
+    for (int i = 0; i < levels; ++i)
+      text += "]}";
+    return text;
+  }
+} // namespace JsonDemo
+
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+TEST_CASE("JsonSerializerRoundTripsNestedObjects", "[reflection][JsonSerializer]")
+{
+  using namespace NGIN::Reflection;
+  using JsonDemo::Config;
+
+  Config src{};
+  src.title = "Quote \" and\nnewline";
+  src.volume = 0.75;
+  src.difficulty = JsonDemo::Difficulty::Hard;
+  src.window = {1920, 1080, true};
+  src.recent = {3, 1, 4};
+  src.keys = {{"jump", 1.5f}, {"run", 2.0f}};
+
+  JsonSerializer json;
+  std::string text;
+  REQUIRE(json.Write(src, text).has_value());
+  CHECK(text.find("\"difficulty\":\"Hard\"") != std::string::npos);
+  CHECK(text.find("\"window\":{\"width\":1920,") != std::string::npos);
+
+  Config dst{};
+  auto read = json.Read(GetType<Config>(), &dst, text);
+  REQUIRE(read.has_value());
+  CHECK(*read == text.size());
+  CHECK(dst.title == src.title);
+  CHECK(dst.volume == 0.75);
+  CHECK(dst.difficulty == JsonDemo::Difficulty::Hard);
+  CHECK(dst.window.height == 1080);
+  CHECK(dst.window.fullscreen);
+  CHECK(dst.recent == src.recent);
+  CHECK(dst.keys == src.keys);
+
+  // Config, Difficulty and Window each get one plan.
+  CHECK(json.PlanCount() == 3);
+}
+#endif
+
+TEST_CASE("JsonSerializerHandlesScalarFieldsByTypeId", "[reflection][JsonSerializer]")
+{
+  using namespace NGIN::Reflection;
+  using JsonDemo::Scalars;
+
+  Scalars src{true, 'A', 200, -7, 4000000000u, -9000000000ll, 0.5f, -1.25, "label"};
+  JsonSerializer json;
+  std::string text;
+  REQUIRE(json.Write(src, text).has_value());
+  CHECK(text == R"({"flag":true,"letter":65,"byte":200,"small":-7,"count":4000000000,"big":-9000000000,"ratio":0.5,"precise":-1.25,"label":"label"})");
+
+  Scalars dst{};
+  REQUIRE(json.Read(GetType<Scalars>(), &dst, text).has_value());
+  CHECK(dst.flag);
+  CHECK(dst.letter == 'A');
+  CHECK(dst.byte == 200);
+  CHECK(dst.small == -7);
+  CHECK(dst.count == 4000000000u);
+  CHECK(dst.big == -9000000000ll);
+  CHECK(dst.ratio == 0.5f);
+  CHECK(dst.precise == -1.25);
+  CHECK(dst.label == "label");
+
+  CHECK_FALSE(json.Read(GetType<Scalars>(), &dst, R"({"byte": 300})").has_value());
+  CHECK_FALSE(json.Read(GetType<Scalars>(), &dst, R"({"flag": 1})").has_value());
+}
+
+TEST_CASE("JsonSerializerSkipsUnknownKeysAndKeepsMissingOnes", "[reflection][JsonSerializer]")
+{
+  using namespace NGIN::Reflection;
+  using JsonDemo::Window;
+
+  JsonSerializer json;
+  Window w{640, 480, false};
+  const std::string_view text = R"( { "height" : 720, "vsync": [true, {"a": null}], "fullscreen": true } )";
+  auto read = json.Read(GetType<Window>(), &w, text);
+  REQUIRE(read.has_value());
+  CHECK(*read == text.size());
+  CHECK(w.width == 640);
+  CHECK(w.height == 720);
+  CHECK(w.fullscreen);
+}
+
+#if defined(NGIN_REFLECTION_ENABLE_FIELD_CODECS)
+TEST_CASE("JsonSerializerRejectsMalformedInput", "[reflection][JsonSerializer]")
+{
+  using namespace NGIN::Reflection;
+  using JsonDemo::Config;
+
+  JsonSerializer json;
+  Config c{};
+  CHECK_FALSE(json.Read(GetType<Config>(), &c, R"({"volume": "loud"})").has_value());
+  CHECK_FALSE(json.Read(GetType<Config>(), &c, R"({"window": {"width": 1.5}})").has_value());
+  CHECK_FALSE(json.Read(GetType<Config>(), &c, R"({"difficulty": "Nightmare"})").has_value());
+  CHECK_FALSE(json.Read(GetType<Config>(), &c, R"({"title": "unterminated)").has_value());
+
+  // Escaped keys still find their field.
+  REQUIRE(json.Read(GetType<Config>(), &c, R"({"\u0074itle": "caf\u00e9"})").has_value());
+  CHECK(c.title == "caf\xC3\xA9");
+}
+
+TEST_CASE("JsonSerializerLimitsNestingDepth", "[reflection][JsonSerializer]")
+{
+  using namespace NGIN::Reflection;
+  using JsonDemo::Tree;
+
+  JsonSerializer json;
+  Tree shallow{};
+  REQUIRE(json.Read(GetType<Tree>(), &shallow, JsonDemo::NestedTree(8)).has_value());
+  CHECK(shallow.children.size() == 1);
+
+  // Each level is an object and an array; past JsonReader::kMaxDepth the read fails
+  // instead of recursing on.
+  Tree deep{};
+  auto read = json.Read(GetType<Tree>(), &deep, JsonDemo::NestedTree(static_cast<int>(JsonReader::kMaxDepth)));
+  CHECK_FALSE(read.has_value());
+}
+#endif
@@ -0,0 +1,191 @@
+// Mapper.cpp - Mapper::Compile copy plans between reflected types
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+#include <vector>
+
+namespace MapperDemo
+{
+  struct NetVec3
+  {
+    float x{0}, y{0}, z{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<NetVec3>, NGIN::Reflection::TypeBuilder<NetVec3> &b)
+  {
+    b.Field<&NetVec3::x>("x");
+    b.Field<&NetVec3::y>("y");
+    b.Field<&NetVec3::z>("z");
+  }
+
+  struct Vec3
+  {
+    float x{0}, y{0}, z{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Vec3>, NGIN::Reflection::TypeBuilder<Vec3> &b)
+  {
+    b.Field<&Vec3::x>("x");
+    b.Field<&Vec3::y>("y");
+    b.Field<&Vec3::z>("z");
+  }
+
+  struct NetPlayerState
+  {
+    int id{0};
+    NetVec3 position{};
+    short health{0};
+    std::string name{};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<NetPlayerState>, NGIN::Reflection::TypeBuilder<NetPlayerState> &b)
+  {
+    b.Field<&NetPlayerState::id>("id");
+    b.Field<&NetPlayerState::position>("position");
+    b.Field<&NetPlayerState::health>("health");
+    b.Field<&NetPlayerState::name>("name");
+  }
+
+  struct Player
+  {
+    int id{0};
+    Vec3 position{};
+    int health{0};
+    std::string name{};
+    int score{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Player>, NGIN::Reflection::TypeBuilder<Player> &b)
+  {
+    b.Field<&Player::id>("id");
+    b.Field<&Player::position>("position");
+    b.Field<&Player::health>("health");
+    b.Field<&Player::name>("name");
+    b.Field<&Player::score>("score");
+  }
+
+  struct Packed
+  {
+    char tag{0};
+    int value{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Packed>, NGIN::Reflection::TypeBuilder<Packed> &b)
+  {
+    b.Field<&Packed::tag>("tag");
+    b.Field<&Packed::value>("value");
+  }
+
+  // Same offsets for tag and value as Packed, with a field of its own in the padding.
+  struct Tagged
+  {
+    char tag{0};
+    char flags{0};
+    int value{0};
+  };
+  inline void NginReflect(NGIN::Reflection::Tag<Tagged>, NGIN::Reflection::TypeBuilder<Tagged> &b)
+  {
+    b.Field<&Tagged::tag>("tag");
+    b.Field<&Tagged::flags>("flags");
+    b.Field<&Tagged::value>("value");
+  }
+} // namespace MapperDemo
+
+TEST_CASE("MapperCopiesMatchingFieldsByName", "[reflection][Mapper]")
+{
+  using namespace NGIN::Reflection;
+  using MapperDemo::NetPlayerState;
+  using MapperDemo::Player;
+
+  auto mapper = Mapper::Compile<NetPlayerState, Player>();
+  REQUIRE(mapper.has_value());
+  // id and the spliced position fields form one range; health converts, name assigns.
+  CHECK(mapper->MappedFieldCount() == 6);
+  CHECK(mapper->CopyRangeCount() == 1);
+
+  NetPlayerState net{7, {1.0f, 2.0f, 3.0f}, 90, "ada"};
+  Player player{};
+  player.score = 12;
+  mapper->Apply(&net, &player);
+  CHECK(player.id == 7);
+  CHECK(player.position.x == 1.0f);
+  CHECK(player.position.z == 3.0f);
+  CHECK(player.health == 90);
+  CHECK(player.name == "ada");
+  CHECK(player.score == 12);
+}
+
+TEST_CASE("MapperDoesNotMergeOverUnmappedFields", "[reflection][Mapper]")
+{
+  using namespace NGIN::Reflection;
+  using MapperDemo::Packed;
+  using MapperDemo::Tagged;
+
+  auto mapper = Mapper::Compile<Packed, Tagged>();
+  REQUIRE(mapper.has_value());
+  CHECK(mapper->CopyRangeCount() == 2);
+
+  Packed src{'a', 5};
+  Tagged dst{};
+  dst.flags = 3;
+  mapper->Apply(&src, &dst);
+  CHECK(dst.tag == 'a');
+  CHECK(dst.flags == 3);
+  CHECK(dst.value == 5);
+
+  // Packed's padding is Tagged::flags in the other direction; ranges only merge when they
+  // touch, so the reverse mapping keeps two as well.
+  auto back = Mapper::Compile<Tagged, Packed>();
+  REQUIRE(back.has_value());
+  CHECK(back->CopyRangeCount() == 2);
+}
+
+TEST_CASE("MapperSkipsNarrowingConversions", "[reflection][Mapper]")
+{
+  using namespace NGIN::Reflection;
+  using MapperDemo::NetPlayerState;
+  using MapperDemo::Player;
+
+  // int -> short could lose the value, so health is left alone in this direction.
+  auto mapper = Mapper::Compile<Player, NetPlayerState>();
+  REQUIRE(mapper.has_value());
+  CHECK(mapper->MappedFieldCount() == 5);
+
+  Player player{};
+  player.id = 3;
+  player.health = 100000;
+  player.name = "bob";
+  NetPlayerState net{};
+  net.health = 42;
+  mapper->Apply(&player, &net);
+  CHECK(net.id == 3);
+  CHECK(net.name == "bob");
+  CHECK(net.health == 42);
+}
+
+TEST_CASE("MapperAppliesToArrays", "[reflection][Mapper]")
+{
+  using namespace NGIN::Reflection;
+  using MapperDemo::NetPlayerState;
+  using MapperDemo::Player;
+
+  auto mapper = Mapper::Compile<NetPlayerState, Player>();
+  REQUIRE(mapper.has_value());
+  std::vector<NetPlayerState> net(4);
+  for (int i = 0; i < 4; ++i)
+  {
+    net[i].id = i;
+    net[i].health = static_cast<short>(10 * i);
+    net[i].name = std::to_string(i);
+  }
+  std::vector<Player> players(4);
+  mapper->ApplyArray(net.data(), players.data(), players.size());
+  CHECK(players[3].id == 3);
+  CHECK(players[3].health == 30);
+  CHECK(players[2].name == "2");
+
+  auto same = Mapper::Compile<MapperDemo::Vec3, MapperDemo::Vec3>();
+  REQUIRE(same.has_value());
+  CHECK(same->CopyRangeCount() == 1);
+  std::vector<MapperDemo::Vec3> a{{1, 2, 3}, {4, 5, 6}}, b(2);
+  same->ApplyArray(a.data(), b.data(), 2);
+  CHECK(b[1].y == 5.0f);
+}
@@ -0,0 +1,179 @@
+// ObjectPool.cpp - Type::CreatePool slab storage, handles and module unload
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace PoolDemo
+{
+  struct Bullet
+  {
+    static inline int alive = 0;
+
+    std::string owner{"none"};
+    float speed{1.0f};
+
+    Bullet() { ++alive; }
+    Bullet(std::string o, float s) : owner(std::move(o)), speed(s) { ++alive; }
+    Bullet(const Bullet &o) : owner(o.owner), speed(o.speed) { ++alive; }
+    Bullet(Bullet &&o) noexcept : owner(std::move(o.owner)), speed(o.speed) { ++alive; }
+    ~Bullet() { --alive; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Bullet>, NGIN::Reflection::TypeBuilder<Bullet> &b)
+    {
+      b.Constructor<std::string, float>();
+    }
+  };
+
+  struct alignas(64) CacheLine
+  {
+    int value{0};
+  };
+
+  struct Spawned
+  {
+    static inline int alive = 0;
+    Spawned() { ++alive; }
+    Spawned(const Spawned &) { ++alive; }
+    ~Spawned() { --alive; }
+  };
+
+  // Drops another pool from its destructor, as objects owning pools of their own do.
+  struct PoolOwner
+  {
+    static inline std::optional<NGIN::Reflection::ObjectPool> *inner = nullptr;
+    ~PoolOwner()
+    {
+      if (inner)
+        inner->reset();
+    }
+  };
+} // namespace PoolDemo
+
+TEST_CASE("ObjectPoolCreatesAndDestroys", "[reflection][ObjectPool]")
+{
+  using namespace NGIN::Reflection;
+  using PoolDemo::Bullet;
+
+  const int before = Bullet::alive;
+  {
+    auto pool = GetType<Bullet>().CreatePool(4);
+    REQUIRE(pool.has_value());
+    CHECK(pool->IsValid());
+    CHECK(pool->GetType().GetTypeId() == GetType<Bullet>().GetTypeId());
+
+    Any args[2] = {Any{std::string{"turret"}}, Any{12.5}};
+    auto h = pool->Create(args, 2);
+    REQUIRE(h.has_value());
+    auto *b = pool->Get<Bullet>(*h);
+    REQUIRE(b != nullptr);
+    CHECK(b->owner == "turret");
+    CHECK(b->speed == 12.5f);
+    CHECK(pool->Size() == 1);
+
+    REQUIRE(pool->Destroy(*h).has_value());
+    CHECK(pool->Get(*h) == nullptr);
+    CHECK(pool->Size() == 0);
+    CHECK(Bullet::alive == before);
+    CHECK_FALSE(pool->Destroy(*h).has_value());
+
+    // The slot is reused with a new generation; the old handle stays stale.
+    const Any *noArgs = nullptr;
+    auto again = pool->Create(noArgs, 0);
+    REQUIRE(again.has_value());
+    CHECK(again->index == h->index);
+    CHECK(pool->Get(*h) == nullptr);
+    CHECK(pool->Get<Bullet>(*again)->owner == "none");
+
+    Any bad[1] = {Any{1}};
+    CHECK_FALSE(pool->Create(bad, 1).has_value());
+    CHECK(pool->Size() == 1);
+  }
+  // Dropping the pool destroys what is still alive.
+  CHECK(Bullet::alive == before);
+
+  CHECK(GetType<Bullet>().CreatePool(0).error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("ObjectPoolGrowsWithStableAddresses", "[reflection][ObjectPool]")
+{
+  using namespace NGIN::Reflection;
+  using PoolDemo::CacheLine;
+
+  auto pool = GetType<CacheLine>().CreatePool(3);
+  REQUIRE(pool.has_value());
+  const Any *noArgs = nullptr;
+  PoolHandle handles[8];
+  void *addresses[8];
+  for (int i = 0; i < 8; ++i)
+  {
+    auto h = pool->Create(noArgs, 0);
+    REQUIRE(h.has_value());
+    handles[i] = *h;
+    addresses[i] = pool->Get(*h);
+    pool->Get<CacheLine>(*h)->value = i;
+    CHECK(reinterpret_cast<std::uintptr_t>(addresses[i]) % alignof(CacheLine) == 0);
+  }
+  CHECK(pool->Size() == 8);
+  CHECK(pool->Capacity() == 9);
+  for (int i = 0; i < 8; ++i)
+  {
+    CHECK(pool->Get(handles[i]) == addresses[i]);
+    CHECK(pool->Get<CacheLine>(handles[i])->value == i);
+  }
+
+  pool->Clear();
+  CHECK(pool->Size() == 0);
+  CHECK(pool->Capacity() == 9);
+  CHECK(pool->Get(handles[0]) == nullptr);
+}
+
+TEST_CASE("ModuleUnloadReleasesPools", "[reflection][ObjectPool]")
+{
+  using namespace NGIN::Reflection;
+  using PoolDemo::Spawned;
+
+  ModuleRegistration module{"PoolDemo.Module"};
+  module.RegisterType<Spawned>();
+  auto pool = GetType<Spawned>().CreatePool(2);
+  REQUIRE(pool.has_value());
+  const Any *noArgs = nullptr;
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(pool->Create(noArgs, 0).has_value());
+  CHECK(Spawned::alive == 3);
+
+  CHECK(UnregisterModule(module.GetModuleId()));
+  CHECK(Spawned::alive == 0);
+  CHECK_FALSE(pool->IsValid());
+  CHECK(pool->Size() == 0);
+  CHECK_FALSE(pool->Create(noArgs, 0).has_value());
+}
+
+TEST_CASE("ModuleUnloadAllowsDestructorsToDropPools", "[reflection][ObjectPool]")
+{
+  using namespace NGIN::Reflection;
+  using PoolDemo::Bullet;
+  using PoolDemo::PoolOwner;
+
+  const int before = Bullet::alive;
+  std::optional<ObjectPool> bullets{*GetType<Bullet>().CreatePool(2)};
+  Any args[2] = {Any{std::string{"owner"}}, Any{1.0f}};
+  REQUIRE(bullets->Create(args, 2).has_value());
+  PoolOwner::inner = &bullets;
+
+  ModuleRegistration module{"PoolDemo.OwnerModule"};
+  module.RegisterType<PoolOwner>();
+  auto owners = GetType<PoolOwner>().CreatePool(1);
+  REQUIRE(owners.has_value());
+  const Any *noArgs = nullptr;
+  REQUIRE(owners->Create(noArgs, 0).has_value());
+
+  CHECK(UnregisterModule(module.GetModuleId()));
+  CHECK_FALSE(bullets.has_value());
+  CHECK(Bullet::alive == before);
+  PoolOwner::inner = nullptr;
+}
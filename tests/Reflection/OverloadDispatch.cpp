@@ -0,0 +1,117 @@
+// OverloadDispatch.cpp - arity buckets and exact-signature lookup for large overload sets
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+namespace DispatchDemo
+{
+  struct Emitter
+  {
+    int last{0};
+
+    int Emit() { return last = 0; }
+    int Emit(int) { return last = 1; }
+    int Emit(long) { return last = 2; }
+    int Emit(double) { return last = 3; }
+    int Emit(float) { return last = 4; }
+    int Emit(int, int) { return last = 5; }
+    int Emit(int, double) { return last = 6; }
+    int Emit(double, double) { return last = 7; }
+    int Emit(int, int, int) { return last = 8; }
+    int Emit(short &out) const { return out = 9; }
+    int EmitAlt(int) { return last = 10; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Emitter>, NGIN::Reflection::TypeBuilder<Emitter> &b)
+    {
+      b.Method<static_cast<int (Emitter::*)()>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(int)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(long)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(double)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(float)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(int, int)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(int, double)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(double, double)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(int, int, int)>(&Emitter::Emit)>("Emit");
+      b.Method<static_cast<int (Emitter::*)(short &) const>(&Emitter::Emit)>("Emit");
+      // Same parameter list as Emit(int): the earlier registration wins ties.
+      b.Method<&Emitter::EmitAlt>("Emit");
+    }
+  };
+
+  int Call(const NGIN::Reflection::Type &t, Emitter &e, NGIN::Reflection::Any *args, NGIN::UIntSize count)
+  {
+    auto r = t.ResolveMethod("Emit", args, count);
+    if (!r.has_value())
+      return -1;
+    return r->Invoke(&e, args, count)->Cast<int>();
+  }
+} // namespace DispatchDemo
+
+TEST_CASE("ExactSignaturesPickTheirOverload", "[reflection][OverloadDispatch]")
+{
+  using namespace NGIN::Reflection;
+  using DispatchDemo::Call;
+
+  auto t = GetType<DispatchDemo::Emitter>();
+  DispatchDemo::Emitter e{};
+  CHECK(Call(t, e, nullptr, 0) == 0);
+  Any i[1] = {Any{1}};
+  CHECK(Call(t, e, i, 1) == 1);
+  Any l[1] = {Any{1L}};
+  CHECK(Call(t, e, l, 1) == 2);
+  Any f[1] = {Any{1.0f}};
+  CHECK(Call(t, e, f, 1) == 4);
+  Any id[2] = {Any{1}, Any{1.0}};
+  CHECK(Call(t, e, id, 2) == 6);
+  Any iii[3] = {Any{1}, Any{2}, Any{3}};
+  CHECK(Call(t, e, iii, 3) == 8);
+}
+
+TEST_CASE("ScoringStaysWithinArityBucket", "[reflection][OverloadDispatch]")
+{
+  using namespace NGIN::Reflection;
+  using DispatchDemo::Call;
+
+  auto t = GetType<DispatchDemo::Emitter>();
+  DispatchDemo::Emitter e{};
+  // long long has no exact one-argument overload but converts to one of them
+  Any ll[1] = {Any{1LL}};
+  const auto picked = Call(t, e, ll, 1);
+  CHECK(picked >= 1);
+  CHECK(picked <= 4);
+  // (float, int) has no exact match but converts within the two-argument bucket
+  Any fi[2] = {Any{1.0f}, Any{1}};
+  CHECK(Call(t, e, fi, 2) >= 5);
+}
+
+TEST_CASE("OutParamsAreNotTakenFromTheExactTable", "[reflection][OverloadDispatch]")
+{
+  using namespace NGIN::Reflection;
+  using DispatchDemo::Call;
+
+  auto t = GetType<DispatchDemo::Emitter>();
+  DispatchDemo::Emitter e{};
+  short out = 0;
+  Any view[1] = {Any{Any::FromRef(out)}};
+  CHECK(Call(t, e, view, 1) == 9);
+  CHECK(out == 9);
+  // A short value matches the Emit(short&) signature but cannot bind it; it promotes to int.
+  Any value[1] = {Any{static_cast<short>(5)}};
+  CHECK(Call(t, e, value, 1) == 1);
+}
+
+TEST_CASE("FailuresStillDiagnoseEveryCandidate", "[reflection][OverloadDispatch]")
+{
+  using namespace NGIN::Reflection;
+
+  auto t = GetType<DispatchDemo::Emitter>();
+  Any args[4] = {Any{1}, Any{2}, Any{3}, Any{4}};
+  auto r = t.ResolveMethod("Emit", args, 4, ResolveOptions{.collectDiagnostics = true});
+  REQUIRE_FALSE(r.has_value());
+  CHECK(r.error().diagnostics.Size() == 11);
+  for (NGIN::UIntSize i = 0; i < r.error().diagnostics.Size(); ++i)
+    CHECK(r.error().diagnostics[i].code == DiagnosticCode::ArityMismatch);
+  REQUIRE(r.error().closestMethodIndex.has_value());
+  CHECK(*r.error().closestMethodIndex == 8);
+}
@@ -0,0 +1,157 @@
+// ReferenceArgs.cpp - passing T& / const T& arguments through AnyView/ConstAnyView
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <array>
+
+namespace RefArgsDemo
+{
+  struct Big
+  {
+    std::array<int, 64> data{};
+    int copies{0};
+    Big() = default;
+    Big(const Big &o) : data(o.data), copies(o.copies + 1) {}
+    Big &operator=(const Big &) = default;
+  };
+
+  struct Accumulator
+  {
+    int total{0};
+
+    void Fill(int &out) const { out = total; }
+    int Sum(const Big &b) const { return b.data[0] + b.data[63] + b.copies; }
+    void Bump(Big &b, int by)
+    {
+      b.data[0] += by;
+      total += by;
+    }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Accumulator>, NGIN::Reflection::TypeBuilder<Accumulator> &b)
+    {
+      b.Field<&Accumulator::total>("total");
+      b.Method<&Accumulator::Fill>("Fill");
+      b.Method<&Accumulator::Sum>("Sum");
+      b.Method<&Accumulator::Bump>("Bump");
+    }
+  };
+
+  void Twice(double &v) { v *= 2.0; }
+  long Widen(const long &v) { return v + 1; }
+
+  inline void RegisterFunctions()
+  {
+    static bool registered = false;
+    if (registered)
+      return;
+    NGIN::Reflection::RegisterFunction<&Twice>("RefArgs::Twice");
+    NGIN::Reflection::RegisterFunction<&Widen>("RefArgs::Widen");
+    registered = true;
+  }
+} // namespace RefArgsDemo
+
+TEST_CASE("OutParamWritesThroughMutableView", "[reflection][ReferenceArgs]")
+{
+  using namespace NGIN::Reflection;
+  using RefArgsDemo::Accumulator;
+
+  auto t = GetType<Accumulator>();
+  Accumulator acc{};
+  acc.total = 41;
+  int out = 0;
+  Any args[1] = {Any{Any::FromRef(out)}};
+  auto resolved = t.ResolveMethod("Fill", args, 1);
+  REQUIRE(resolved.has_value());
+  REQUIRE(resolved->Invoke(&acc, args, 1).has_value());
+  CHECK(out == 41);
+}
+
+TEST_CASE("OutParamRejectsOwnedValuesAndConstViews", "[reflection][ReferenceArgs]")
+{
+  using namespace NGIN::Reflection;
+  using RefArgsDemo::Accumulator;
+
+  auto t = GetType<Accumulator>();
+  int out = 0;
+  Any byValue[1] = {Any{0}};
+  auto r1 = t.ResolveMethod("Fill", byValue, 1, ResolveOptions{.collectDiagnostics = true});
+  REQUIRE_FALSE(r1.has_value());
+  REQUIRE(r1.error().diagnostics.Size() == 1);
+  CHECK(r1.error().diagnostics[0].code == DiagnosticCode::NonConvertible);
+
+  Any constView[1] = {Any{Any::FromConstRef(out)}};
+  CHECK_FALSE(t.ResolveMethod("Fill", constView, 1).has_value());
+
+  long wrongType = 0;
+  Any mismatched[1] = {Any{Any::FromRef(wrongType)}};
+  CHECK_FALSE(t.ResolveMethod("Fill", mismatched, 1).has_value());
+
+  Accumulator acc{};
+  auto m = t.GetMethod("Fill").value();
+  CHECK_FALSE(m.Invoke(&acc, byValue, 1).has_value());
+}
+
+TEST_CASE("ConstRefParamBindsWithoutCopy", "[reflection][ReferenceArgs]")
+{
+  using namespace NGIN::Reflection;
+  using RefArgsDemo::Accumulator;
+  using RefArgsDemo::Big;
+
+  auto t = GetType<Accumulator>();
+  Accumulator acc{};
+  Big big{};
+  big.data[0] = 3;
+  big.data[63] = 4;
+
+  Any viaConst[1] = {Any{Any::FromConstRef(big)}};
+  auto resolved = t.ResolveMethod("Sum", viaConst, 1);
+  REQUIRE(resolved.has_value());
+  CHECK(resolved->Invoke(&acc, viaConst, 1)->Cast<int>() == 7);
+
+  Any viaMut[1] = {Any{Any::FromRef(big)}};
+  CHECK(t.GetMethod("Sum")->Invoke(&acc, viaMut, 1)->Cast<int>() == 7);
+
+  // An owned Big binds in place as well; only the copy into the Any is counted.
+  Any owned[1] = {Any{big}};
+  CHECK(t.GetMethod("Sum")->Invoke(&acc, owned, 1)->Cast<int>() == 8);
+}
+
+TEST_CASE("MutableReferenceMixesWithValueArguments", "[reflection][ReferenceArgs]")
+{
+  using namespace NGIN::Reflection;
+  using RefArgsDemo::Accumulator;
+  using RefArgsDemo::Big;
+
+  auto t = GetType<Accumulator>();
+  Accumulator acc{};
+  Big big{};
+  Any args[2] = {Any{Any::FromRef(big)}, Any{static_cast<short>(5)}};
+  auto resolved = t.ResolveMethod("Bump", args, 2);
+  REQUIRE(resolved.has_value());
+  REQUIRE(resolved->Invoke(&acc, args, 2).has_value());
+  CHECK(big.data[0] == 5);
+  CHECK(big.copies == 0);
+  CHECK(acc.total == 5);
+}
+
+TEST_CASE("FunctionsAcceptReferenceViews", "[reflection][ReferenceArgs]")
+{
+  using namespace NGIN::Reflection;
+  RefArgsDemo::RegisterFunctions();
+
+  double v = 1.5;
+  Any args[1] = {Any{Any::FromRef(v)}};
+  auto twice = ResolveFunction("RefArgs::Twice", args, 1);
+  REQUIRE(twice.has_value());
+  REQUIRE(twice->Invoke(args, 1).has_value());
+  CHECK(v == 3.0);
+
+  // const T& parameters still accept arithmetic conversions through a view.
+  int small = 9;
+  Any widen[1] = {Any{Any::FromConstRef(small)}};
+  auto f = ResolveFunction("RefArgs::Widen", widen, 1);
+  REQUIRE(f.has_value());
+  CHECK(f->Invoke(widen, 1)->Cast<long>() == 10);
+}
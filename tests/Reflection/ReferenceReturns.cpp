@@ -0,0 +1,149 @@
+// ReferenceReturns.cpp - InvokeView/GetView on reference-returning methods and getters
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <array>
+
+namespace RefRetDemo
+{
+  struct Mesh
+  {
+    std::array<float, 32> vertices{};
+  };
+
+  struct Transform
+  {
+    float x{0}, y{0}, z{0};
+  };
+
+  struct Node
+  {
+    Mesh mesh{};
+    Transform transform{};
+    int id{7};
+
+    const Mesh &GetMesh() const { return mesh; }
+    Transform &GetTransform() { return transform; }
+    int GetId() const { return id; }
+    const float &Vertex(int i) const { return mesh.vertices[static_cast<std::size_t>(i)]; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Node>, NGIN::Reflection::TypeBuilder<Node> &b)
+    {
+      b.Method<&Node::GetMesh>("GetMesh");
+      b.Method<&Node::GetTransform>("GetTransform");
+      b.Method<&Node::GetId>("GetId");
+      b.Method<&Node::Vertex>("Vertex");
+      b.Property<&Node::GetMesh>("Mesh");
+      b.Property<&Node::GetTransform>("Transform");
+      b.Property<&Node::GetId>("Id");
+    }
+  };
+} // namespace RefRetDemo
+
+TEST_CASE("InvokeViewPointsAtReferencedObject", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Mesh;
+  using RefRetDemo::Node;
+
+  auto t = GetType<Node>();
+  Node n{};
+  n.mesh.vertices[3] = 2.5f;
+
+  auto m = t.GetMethod("GetMesh").value();
+  CHECK(m.ReturnsReference());
+  CHECK(m.GetTypeId() == GetType<Mesh>().GetTypeId());
+  auto view = m.InvokeView(&n, nullptr, 0);
+  REQUIRE(view.has_value());
+  CHECK(&view->Cast<Mesh>() == &n.mesh);
+  CHECK(view->Cast<Mesh>().vertices[3] == 2.5f);
+
+  // const T& results cannot be viewed mutably
+  CHECK_FALSE(m.InvokeMutView(&n, nullptr, 0).has_value());
+}
+
+TEST_CASE("InvokeMutViewWritesThrough", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Node;
+  using RefRetDemo::Transform;
+
+  auto t = GetType<Node>();
+  Node n{};
+  auto m = t.GetMethod("GetTransform").value();
+  auto view = m.InvokeMutView(&n, nullptr, 0);
+  REQUIRE(view.has_value());
+  view->Cast<Transform>().y = 4.0f;
+  CHECK(n.transform.y == 4.0f);
+  CHECK(m.InvokeView(&n, nullptr, 0)->Cast<Transform>().y == 4.0f);
+}
+
+TEST_CASE("InvokeViewConvertsArguments", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Node;
+
+  auto t = GetType<Node>();
+  Node n{};
+  Any args[1] = {Any{static_cast<short>(5)}};
+  auto view = t.GetMethod("Vertex")->InvokeView(&n, args, 1);
+  REQUIRE(view.has_value());
+  CHECK(&view->Cast<float>() == &n.mesh.vertices[5]);
+}
+
+TEST_CASE("InvokeViewRejectsValueReturns", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Node;
+
+  auto t = GetType<Node>();
+  Node n{};
+  auto m = t.GetMethod("GetId").value();
+  CHECK_FALSE(m.ReturnsReference());
+  auto view = m.InvokeView(&n, nullptr, 0);
+  REQUIRE_FALSE(view.has_value());
+  CHECK(view.error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("TypedResolveMatchesReferenceReturn", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Mesh;
+  using RefRetDemo::Node;
+
+  auto t = GetType<Node>();
+  auto m = t.ResolveMethod<Mesh>("GetMesh");
+  REQUIRE(m.has_value());
+  CHECK(m->ReturnsReference());
+}
+
+TEST_CASE("PropertyGetViewAvoidsCopies", "[reflection][ReferenceReturns]")
+{
+  using namespace NGIN::Reflection;
+  using RefRetDemo::Mesh;
+  using RefRetDemo::Node;
+  using RefRetDemo::Transform;
+
+  auto t = GetType<Node>();
+  Node n{};
+
+  auto mesh = t.GetProperty("Mesh").value();
+  CHECK(mesh.ReturnsReference());
+  auto mv = mesh.GetView(n);
+  REQUIRE(mv.has_value());
+  CHECK(&mv->Cast<Mesh>() == &n.mesh);
+  CHECK_FALSE(mesh.GetMutView(n).has_value());
+
+  auto xf = t.GetProperty("Transform").value();
+  auto xv = xf.GetMutView(n);
+  REQUIRE(xv.has_value());
+  xv->Cast<Transform>().z = 9.0f;
+  CHECK(n.transform.z == 9.0f);
+
+  auto id = t.GetProperty("Id").value();
+  CHECK_FALSE(id.ReturnsReference());
+  CHECK_FALSE(id.GetView(n).has_value());
+  CHECK(id.GetAny(n).Cast<int>() == 7);
+}
@@ -0,0 +1,128 @@
+// ResolutionCache.cpp - process-wide memo of overload resolution results
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+namespace ResCacheDemo
+{
+  struct Calc
+  {
+    int base{0};
+    Calc() = default;
+    Calc(int b) : base(b) {}
+    Calc(double b) : base(static_cast<int>(b) * 10) {}
+
+    int Mul(int v) const { return base * v; }
+    double Mul(double v) const { return base * v + 0.5; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Calc>, NGIN::Reflection::TypeBuilder<Calc> &b)
+    {
+      b.Constructor<int>();
+      b.Constructor<double>();
+      b.Method<static_cast<int (Calc::*)(int) const>(&Calc::Mul)>("Mul");
+      b.Method<static_cast<double (Calc::*)(double) const>(&Calc::Mul)>("Mul");
+    }
+  };
+
+  long Pick(double) { return 1; }
+  long Pick(int) { return 2; }
+} // namespace ResCacheDemo
+
+TEST_CASE("ResolveMethodHitsCacheOnRepeatedShapes", "[reflection][ResolutionCache]")
+{
+  using namespace NGIN::Reflection;
+  using ResCacheDemo::Calc;
+
+  auto t = GetType<Calc>();
+  ClearResolutionCache();
+  Calc c{3};
+  Any ints[1] = {Any{2}};
+  Any doubles[1] = {Any{2.0}};
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto ri = t.ResolveMethod("Mul", ints, 1);
+    REQUIRE(ri.has_value());
+    CHECK(ri->Invoke(&c, ints, 1)->Cast<int>() == 6);
+    auto rd = t.ResolveMethod("Mul", doubles, 1);
+    REQUIRE(rd.has_value());
+    CHECK(rd->Invoke(&c, doubles, 1)->Cast<double>() == 6.5);
+  }
+  auto stats = GetResolutionCacheStats();
+  CHECK(stats.misses == 2);
+  CHECK(stats.hits == 6);
+  CHECK(stats.entries == 2);
+  CHECK(stats.HitRate() == 0.75);
+}
+
+TEST_CASE("CachedResolutionKeepsConversionPlan", "[reflection][ResolutionCache]")
+{
+  using namespace NGIN::Reflection;
+  using ResCacheDemo::Calc;
+
+  auto t = GetType<Calc>();
+  ClearResolutionCache();
+  Calc c{4};
+  Any shorts[1] = {Any{static_cast<short>(3)}};
+  auto first = t.ResolveMethod("Mul", shorts, 1);
+  auto second = t.ResolveMethod("Mul", shorts, 1);
+  REQUIRE(first.has_value());
+  REQUIRE(second.has_value());
+  CHECK(GetResolutionCacheStats().hits == 1);
+  CHECK(first->MethodHandle().GetTypeId() == second->MethodHandle().GetTypeId());
+  CHECK(second->Invoke(&c, shorts, 1)->Cast<int>() == 12);
+}
+
+TEST_CASE("ConstructUsesResolutionCache", "[reflection][ResolutionCache]")
+{
+  using namespace NGIN::Reflection;
+  using ResCacheDemo::Calc;
+
+  auto t = GetType<Calc>();
+  ClearResolutionCache();
+  Any ints[1] = {Any{5}};
+  Any doubles[1] = {Any{5.0}};
+  CHECK(t.Construct(ints, 1)->Cast<Calc>().base == 5);
+  CHECK(t.Construct(ints, 1)->Cast<Calc>().base == 5);
+  CHECK(t.Construct(doubles, 1)->Cast<Calc>().base == 50);
+  auto stats = GetResolutionCacheStats();
+  CHECK(stats.hits == 1);
+  CHECK(stats.misses == 2);
+}
+
+TEST_CASE("FunctionRegistrationInvalidatesCache", "[reflection][ResolutionCache]")
+{
+  using namespace NGIN::Reflection;
+
+  ClearResolutionCache();
+  (void)RegisterFunction<static_cast<long (*)(double)>(&ResCacheDemo::Pick)>("ResCache::Pick");
+  Any ints[1] = {Any{1}};
+  CHECK(ResolveFunction("ResCache::Pick", ints, 1)->Invoke(ints, 1)->Cast<long>() == 1);
+  CHECK(ResolveFunction("ResCache::Pick", ints, 1)->Invoke(ints, 1)->Cast<long>() == 1);
+  CHECK(GetResolutionCacheStats().hits == 1);
+
+  // A better overload registered later must win over the cached choice.
+  (void)RegisterFunction<static_cast<long (*)(int)>(&ResCacheDemo::Pick)>("ResCache::Pick");
+  CHECK(ResolveFunction("ResCache::Pick", ints, 1)->Invoke(ints, 1)->Cast<long>() == 2);
+  CHECK(GetResolutionCacheStats().hits == 1);
+}
+
+TEST_CASE("FailedResolutionIsNotCached", "[reflection][ResolutionCache]")
+{
+  using namespace NGIN::Reflection;
+  using ResCacheDemo::Calc;
+
+  auto t = GetType<Calc>();
+  ClearResolutionCache();
+  Any bad[1] = {Any{std::string_view{"x"}}};
+  for (int i = 0; i < 2; ++i)
+  {
+    auto r = t.ResolveMethod("Mul", bad, 1, ResolveOptions{.collectDiagnostics = true});
+    REQUIRE_FALSE(r.has_value());
+    CHECK(r.error().diagnostics.Size() == 2);
+  }
+  auto stats = GetResolutionCacheStats();
+  CHECK(stats.hits == 0);
+  CHECK(stats.entries == 0);
+}
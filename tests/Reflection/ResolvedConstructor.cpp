@@ -0,0 +1,102 @@
+// ResolvedConstructor.cpp - reusable constructor plans and exact construct thunks
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+
+namespace ResolvedCtorDemo
+{
+  struct Entity
+  {
+    int id{0};
+    double health{100.0};
+    std::string tag{};
+
+    Entity() = default;
+    explicit Entity(int i) : id(i) {}
+    Entity(int i, double h) : id(i), health(h) {}
+    Entity(std::string t, int i) : id(i), tag(std::move(t)) {}
+
+    friend void NginReflect(NGIN::Reflection::Tag<Entity>, NGIN::Reflection::TypeBuilder<Entity> &b)
+    {
+      b.Constructor<int>();
+      b.Constructor<int, double>();
+      b.Constructor<std::string, int>();
+    }
+  };
+} // namespace ResolvedCtorDemo
+
+TEST_CASE("ResolveConstructorReusesPlan", "[reflection][ResolvedConstructor]")
+{
+  using namespace NGIN::Reflection;
+  using ResolvedCtorDemo::Entity;
+
+  auto t = GetType<Entity>();
+  Any args[2] = {Any{3}, Any{50.0}};
+  auto ctor = t.ResolveConstructor(args, 2);
+  REQUIRE(ctor.has_value());
+  CHECK(ctor->IsValid());
+  CHECK(ctor->ArgumentCount() == 2);
+  CHECK(ctor->GetConstructor().ParameterCount() == 2);
+  for (int i = 0; i < 3; ++i)
+  {
+    Any next[2] = {Any{i}, Any{10.0 * i}};
+    auto e = ctor->Construct(next, 2);
+    REQUIRE(e.has_value());
+    CHECK(e->Cast<Entity>().id == i);
+    CHECK(e->Cast<Entity>().health == 10.0 * i);
+  }
+
+  // A plan only accepts the argument types it was resolved for.
+  Any other[2] = {Any{1}, Any{2}};
+  auto bad = ctor->Construct(other, 2);
+  REQUIRE_FALSE(bad.has_value());
+  CHECK(bad.error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("ResolveConstructorConvertsArguments", "[reflection][ResolvedConstructor]")
+{
+  using namespace NGIN::Reflection;
+  using ResolvedCtorDemo::Entity;
+
+  auto t = GetType<Entity>();
+  Any args[2] = {Any{static_cast<short>(4)}, Any{2.5f}};
+  auto ctor = t.ResolveConstructor(args, 2);
+  REQUIRE(ctor.has_value());
+  auto e = ctor->Construct(args, 2);
+  REQUIRE(e.has_value());
+  CHECK(e->Cast<Entity>().id == 4);
+  CHECK(e->Cast<Entity>().health == 2.5);
+
+  const Any *noArgs = nullptr;
+  auto def = t.ResolveConstructor(noArgs, 0);
+  REQUIRE(def.has_value());
+  CHECK(def->Construct(noArgs, 0)->Cast<Entity>().health == 100.0);
+
+  Any none[1] = {Any{std::string_view{"x"}}};
+  auto missing = t.ResolveConstructor(none, 1);
+  REQUIRE_FALSE(missing.has_value());
+  CHECK(missing.error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("TypedResolveConstructorIsExact", "[reflection][ResolvedConstructor]")
+{
+  using namespace NGIN::Reflection;
+  using ResolvedCtorDemo::Entity;
+
+  auto t = GetType<Entity>();
+  auto ctor = t.ResolveConstructor<std::string, int>();
+  REQUIRE(ctor.has_value());
+  auto e = ctor->ConstructFrom(std::string{"orc"}, 9);
+  REQUIRE(e.has_value());
+  CHECK(e->Cast<Entity>().tag == "orc");
+  CHECK(e->Cast<Entity>().id == 9);
+
+  CHECK(t.ResolveConstructor<int>().has_value());
+  CHECK(t.ResolveConstructor<>().has_value());
+  auto missing = t.ResolveConstructor<double>();
+  REQUIRE_FALSE(missing.has_value());
+  CHECK(missing.error().code == ErrorCode::NotFound);
+}
@@ -0,0 +1,113 @@
+// ResolvedPlan.cpp - inline argument plans and per-argument converters of resolved calls
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string>
+
+namespace ResolvedPlanDemo
+{
+  struct Scaler
+  {
+    double factor{2.0};
+    double Scale(double v, long bias) const { return v * factor + static_cast<double>(bias); }
+    int Clamp(int v) { return v < 0 ? 0 : v; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Scaler>, NGIN::Reflection::TypeBuilder<Scaler> &b)
+    {
+      b.Method<&Scaler::Scale>("Scale");
+      b.Method<&Scaler::Clamp>("Clamp");
+    }
+  };
+
+  long long Sum9(int a, int b, int c, int d, int e, int f, int g, int h, long long i)
+  {
+    return a + b + c + d + e + f + g + h + i;
+  }
+
+  std::string Label(std::string s, int n) { return s + std::to_string(n); }
+
+  inline void RegisterFunctions()
+  {
+    static bool registered = false;
+    if (registered)
+      return;
+    NGIN::Reflection::RegisterFunction<&Sum9>("ResolvedPlan::Sum9");
+    NGIN::Reflection::RegisterFunction<&Label>("ResolvedPlan::Label");
+    registered = true;
+  }
+} // namespace ResolvedPlanDemo
+
+TEST_CASE("ArithmeticConvertersAreDirect", "[reflection][ResolvedPlan]")
+{
+  using namespace NGIN::Reflection;
+
+  auto toInt = detail::FindArgConverter(detail::TypeIdOf<short>(), detail::TypeIdOf<int>());
+  REQUIRE(toInt != nullptr);
+  short s = -7;
+  int i = 0;
+  toInt(&s, &i);
+  CHECK(i == -7);
+
+  auto toDouble = detail::FindArgConverter(detail::TypeIdOf<float>(), detail::TypeIdOf<double>());
+  REQUIRE(toDouble != nullptr);
+  float f = 1.5f;
+  double d = 0.0;
+  toDouble(&f, &d);
+  CHECK(d == 1.5);
+
+  CHECK(detail::FindArgConverter(detail::TypeIdOf<std::string>(), detail::TypeIdOf<int>()) == nullptr);
+  CHECK(detail::FindArgConverter(detail::TypeIdOf<int>(), detail::TypeIdOf<std::string>()) == nullptr);
+}
+
+TEST_CASE("ResolvedMethodInvokesThroughConverters", "[reflection][ResolvedPlan]")
+{
+  using namespace NGIN::Reflection;
+  using ResolvedPlanDemo::Scaler;
+
+  auto t = GetType<Scaler>();
+  Scaler sc{};
+  Any args[2] = {Any{3.0f}, Any{static_cast<short>(1)}};
+  auto r = t.ResolveMethod("Scale", args, 2);
+  REQUIRE(r.has_value());
+  CHECK(r->ArgumentCount() == 2);
+  CHECK(r->Invoke(&sc, args, 2)->Cast<double>() == 7.0);
+
+  // Conversions also read through views.
+  unsigned char small = 5;
+  Any viaView[1] = {Any{Any::FromConstRef(small)}};
+  auto clamp = t.ResolveMethod("Clamp", viaView, 1);
+  REQUIRE(clamp.has_value());
+  CHECK(clamp->Invoke(&sc, viaView, 1)->Cast<int>() == 5);
+
+  // A plan only accepts the argument types it was resolved for.
+  Any other[2] = {Any{3.0}, Any{1L}};
+  auto bad = r->Invoke(&sc, other, 2);
+  REQUIRE_FALSE(bad.has_value());
+  CHECK(bad.error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("ResolvedFunctionBeyondInlineCapacity", "[reflection][ResolvedPlan]")
+{
+  using namespace NGIN::Reflection;
+  ResolvedPlanDemo::RegisterFunctions();
+
+  Any args[9] = {Any{1}, Any{2}, Any{static_cast<short>(3)}, Any{4}, Any{5},
+                 Any{6}, Any{7}, Any{static_cast<char>(8)}, Any{9}};
+  auto r = ResolveFunction("ResolvedPlan::Sum9", args, 9);
+  REQUIRE(r.has_value());
+  CHECK(r->ArgumentCount() == 9);
+  CHECK(r->Invoke(args, 9)->Cast<long long>() == 45);
+}
+
+TEST_CASE("NonArithmeticArgumentsStillBindExactly", "[reflection][ResolvedPlan]")
+{
+  using namespace NGIN::Reflection;
+  ResolvedPlanDemo::RegisterFunctions();
+
+  Any args[2] = {Any{std::string{"n"}}, Any{static_cast<short>(4)}};
+  auto r = ResolveFunction("ResolvedPlan::Label", args, 2);
+  REQUIRE(r.has_value());
+  CHECK(r->Invoke(args, 2)->Cast<std::string>() == "n4");
+}
@@ -0,0 +1,105 @@
+// SignatureIndex.cpp - typed resolution through the (name, signature hash) index
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+namespace SigIndexDemo
+{
+  struct Shape
+  {
+    int sides{3};
+
+    int Area() const { return sides * 10; }
+    double Area(double scale) const { return sides * scale; }
+    int Area(int scale) const { return sides * scale; }
+    long Area(int a, int b) const { return static_cast<long>(a) * b; }
+    void Reset() { sides = 0; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Shape>, NGIN::Reflection::TypeBuilder<Shape> &b)
+    {
+      b.Method<static_cast<int (Shape::*)() const>(&Shape::Area)>("Area");
+      b.Method<static_cast<double (Shape::*)(double) const>(&Shape::Area)>("Area");
+      b.Method<static_cast<int (Shape::*)(int) const>(&Shape::Area)>("Area");
+      b.Method<static_cast<long (Shape::*)(int, int) const>(&Shape::Area)>("Area");
+      b.Method<&Shape::Reset>("Reset");
+    }
+  };
+
+  int Twice(int v) { return v * 2; }
+  double Twice(double v) { return v * 2.0; }
+} // namespace SigIndexDemo
+
+TEST_CASE("TypedSignatureHashIsCompileTime", "[reflection][SignatureIndex]")
+{
+  using namespace NGIN::Reflection;
+
+  constexpr auto a = detail::TypedSignatureHash<int, double>();
+  constexpr auto b = detail::TypedSignatureHash<double, int>();
+  constexpr auto c = detail::TypedSignatureHash<void, int, double>();
+  constexpr auto d = detail::TypedSignatureHash<void, double, int>();
+  STATIC_REQUIRE(a != b);
+  STATIC_REQUIRE(c != d);
+  // References and cv-qualifiers do not change the signature, as with registered type ids.
+  STATIC_REQUIRE(detail::TypedSignatureHash<const int &, double &>() == a);
+
+  const NGIN::UInt64 ids[2] = {detail::TypeIdOf<int>(), detail::TypeIdOf<double>()};
+  CHECK(detail::SignatureHash(0, ids, 2) == c);
+}
+
+TEST_CASE("TypedResolveMethodUsesSignatureIndex", "[reflection][SignatureIndex]")
+{
+  using namespace NGIN::Reflection;
+  using SigIndexDemo::Shape;
+
+  auto t = GetType<Shape>();
+  Shape s{4};
+
+  auto byInt = t.ResolveMethod<int, int>("Area");
+  REQUIRE(byInt.has_value());
+  Any i[1] = {Any{5}};
+  CHECK(byInt->Invoke(&s, i, 1)->Cast<int>() == 20);
+
+  auto byDouble = t.ResolveMethod<double, double>("Area");
+  REQUIRE(byDouble.has_value());
+  Any d[1] = {Any{0.5}};
+  CHECK(byDouble->Invoke(&s, d, 1)->Cast<double>() == 2.0);
+
+  auto none = t.ResolveMethod<int>("Area");
+  REQUIRE(none.has_value());
+  CHECK(none->Invoke(&s, nullptr, 0)->Cast<int>() == 40);
+
+  CHECK(t.ResolveMethod<long, int, int>("Area").has_value());
+  CHECK(t.ResolveMethod<long(int, int)>("Area").has_value());
+  CHECK(t.ResolveMethod("Reset").has_value());
+
+  // Parameters match but the return type does not.
+  auto wrongRet = t.ResolveMethod<long, int>("Area");
+  REQUIRE_FALSE(wrongRet.has_value());
+  CHECK(wrongRet.error().code == ErrorCode::InvalidArgument);
+
+  auto missing = t.ResolveMethod<int, int>("Perimeter");
+  REQUIRE_FALSE(missing.has_value());
+  CHECK(missing.error().code == ErrorCode::NotFound);
+}
+
+TEST_CASE("TypedResolveFunctionUsesSignatureIndex", "[reflection][SignatureIndex]")
+{
+  using namespace NGIN::Reflection;
+
+  (void)RegisterFunction<static_cast<int (*)(int)>(&SigIndexDemo::Twice)>("SigIndex::Twice");
+  (void)RegisterFunction<static_cast<double (*)(double)>(&SigIndexDemo::Twice)>("SigIndex::Twice");
+
+  auto fd = ResolveFunction<double(double)>("SigIndex::Twice");
+  REQUIRE(fd.has_value());
+  Any d[1] = {Any{1.25}};
+  CHECK(fd->Invoke(d, 1)->Cast<double>() == 2.5);
+
+  auto fi = ResolveFunction<int, int>("SigIndex::Twice");
+  REQUIRE(fi.has_value());
+  Any i[1] = {Any{7}};
+  CHECK(fi->Invoke(i, 1)->Cast<int>() == 14);
+
+  CHECK(ResolveFunction<float(float)>("SigIndex::Twice").error().code == ErrorCode::InvalidArgument);
+  CHECK(ResolveFunction<int(int)>("SigIndex::Missing").error().code == ErrorCode::NotFound);
+}
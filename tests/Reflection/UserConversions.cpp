@@ -0,0 +1,180 @@
+// UserConversions.cpp - TypeBuilder::ConvertsTo and conversion costs in overload resolution
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NGIN/Reflection/Reflection.hpp>
+
+#include <string_view>
+
+namespace UserConvDemo
+{
+  struct Vec4
+  {
+    float x{0}, y{0}, z{0}, w{0};
+  };
+
+  struct Vec3
+  {
+    float x{0}, y{0}, z{0};
+
+    friend void NginReflect(NGIN::Reflection::Tag<Vec3>, NGIN::Reflection::TypeBuilder<Vec3> &b);
+  };
+
+  Vec4 ToVec4(const Vec3 &v) { return Vec4{v.x, v.y, v.z, 1.0f}; }
+  // Only reachable when the cheaper Vec4 conversion does not apply.
+  double ToLength(const Vec3 &v) { return static_cast<double>(v.x + v.y + v.z); }
+
+  inline void NginReflect(NGIN::Reflection::Tag<Vec3>, NGIN::Reflection::TypeBuilder<Vec3> &b)
+  {
+    b.ConvertsTo<Vec4, &ToVec4>();
+    b.ConvertsTo<double, &ToLength>(5);
+  }
+
+  struct StringId
+  {
+    std::string_view text{};
+    std::string_view View() const { return text; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<StringId>, NGIN::Reflection::TypeBuilder<StringId> &b)
+    {
+      b.ConvertsTo<std::string_view, &StringId::View>();
+    }
+  };
+
+  struct Sink
+  {
+    float last{0};
+    NGIN::UIntSize length{0};
+
+    float Take(Vec4 v) { return last = v.w; }
+    float Take(int v) { return last = static_cast<float>(v); }
+    NGIN::UIntSize Name(std::string_view s) { return length = s.size(); }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Sink>, NGIN::Reflection::TypeBuilder<Sink> &b)
+    {
+      b.Method<static_cast<float (Sink::*)(Vec4)>(&Sink::Take)>("Take");
+      b.Method<static_cast<float (Sink::*)(int)>(&Sink::Take)>("Take");
+      b.Method<&Sink::Name>("Name");
+    }
+  };
+
+  struct Box
+  {
+    Vec4 corner{};
+    Box() = default;
+    explicit Box(Vec4 c) : corner(c) {}
+
+    friend void NginReflect(NGIN::Reflection::Tag<Box>, NGIN::Reflection::TypeBuilder<Box> &b)
+    {
+      b.Constructor<Vec4>();
+    }
+  };
+
+  double Scale(double v) { return v * 2.0; }
+
+  struct Meters
+  {
+    double value{0};
+    double Value() const { return value; }
+
+    friend void NginReflect(NGIN::Reflection::Tag<Meters>, NGIN::Reflection::TypeBuilder<Meters> &b)
+    {
+      b.ConvertsTo<double, &Meters::Value>();
+    }
+  };
+
+  inline void Register()
+  {
+    (void)NGIN::Reflection::GetType<Vec3>();
+    (void)NGIN::Reflection::GetType<StringId>();
+  }
+} // namespace UserConvDemo
+
+TEST_CASE("ConvertsToAddsGraphEdges", "[reflection][UserConversions]")
+{
+  using namespace NGIN::Reflection;
+  using namespace UserConvDemo;
+  Register();
+
+  const auto from = detail::TypeIdOf<Vec3>();
+  auto convert = detail::FindArgConverter(from, detail::TypeIdOf<Vec4>());
+  REQUIRE(convert != nullptr);
+  Vec3 v{1, 2, 3};
+  Vec4 out{};
+  convert(&v, &out);
+  CHECK(out.z == 3.0f);
+  CHECK(out.w == 1.0f);
+
+  int cost = 0;
+  CHECK(detail::FindUserConversion(from, detail::TypeIdOf<double>(), cost) != nullptr);
+  CHECK(cost == 5);
+  CHECK(detail::FindUserConversion(from, detail::TypeIdOf<int>(), cost) == nullptr);
+  CHECK(detail::FindUserConversion(detail::TypeIdOf<Vec4>(), from, cost) == nullptr);
+}
+
+TEST_CASE("ResolutionScoresUserConversions", "[reflection][UserConversions]")
+{
+  using namespace NGIN::Reflection;
+  using namespace UserConvDemo;
+  Register();
+
+  auto t = GetType<Sink>();
+  Sink s{};
+  Any vec[1] = {Any{Vec3{1, 2, 3}}};
+  auto r = t.ResolveMethod("Take", vec, 1);
+  REQUIRE(r.has_value());
+  CHECK(r->Invoke(&s, vec, 1)->Cast<float>() == 1.0f);
+
+  // Arithmetic conversions still win over user-defined ones.
+  Any shorts[1] = {Any{static_cast<short>(7)}};
+  CHECK(t.ResolveMethod("Take", shorts, 1)->Invoke(&s, shorts, 1)->Cast<float>() == 7.0f);
+
+  // Views are converted from the object they refer to.
+  StringId id{"mesh/crate"};
+  Any name[1] = {Any{Any::FromConstRef(id)}};
+  auto n = t.ResolveMethod("Name", name, 1);
+  REQUIRE(n.has_value());
+  CHECK(n->Invoke(&s, name, 1)->Cast<NGIN::UIntSize>() == 10);
+}
+
+TEST_CASE("UserConversionsApplyToFunctionsAndConstructors", "[reflection][UserConversions]")
+{
+  using namespace NGIN::Reflection;
+  using namespace UserConvDemo;
+  Register();
+
+  (void)RegisterFunction<&Scale>("UserConv::Scale");
+  Any vec[1] = {Any{Vec3{1, 1, 2}}};
+  auto f = ResolveFunction("UserConv::Scale", vec, 1);
+  REQUIRE(f.has_value());
+  CHECK(f->Invoke(vec, 1)->Cast<double>() == 8.0);
+
+  auto box = GetType<Box>().Construct(vec, 1);
+  REQUIRE(box.has_value());
+  CHECK(box->Cast<Box>().corner.w == 1.0f);
+}
+
+TEST_CASE("PlainInvokeAppliesUserConversions", "[reflection][UserConversions]")
+{
+  using namespace NGIN::Reflection;
+  using namespace UserConvDemo;
+  Register();
+
+  auto m = GetType<Sink>().GetMethod("Name");
+  REQUIRE(m.has_value());
+  Sink s{};
+  Any owned[1] = {Any{StringId{"crate"}}};
+  CHECK(m->Invoke(&s, owned, 1)->Cast<NGIN::UIntSize>() == 5);
+  StringId id{"mesh/crate"};
+  Any view[1] = {Any{Any::FromConstRef(id)}};
+  CHECK(m->Invoke(&s, view, 1)->Cast<NGIN::UIntSize>() == 10);
+}
+
+TEST_CASE("ConvertsToBumpsRegistryEpoch", "[reflection][UserConversions]")
+{
+  using namespace NGIN::Reflection;
+
+  const auto before = detail::RegistryEpoch();
+  (void)GetType<UserConvDemo::Meters>();
+  CHECK(detail::RegistryEpoch() != before);
+}